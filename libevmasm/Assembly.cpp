@@ -29,12 +29,24 @@
 #include <libevmasm/BlockDeduplicator.h>
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/SemanticInformation.h>
 
 #include <liblangutil/Exceptions.h>
 
-#include <fstream>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/Profiler.h>
+
 #include <json/json.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -390,8 +402,175 @@ Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreat
 }
 
 
+namespace
+{
+
+/// Set while a thread works on a parallelFor, so that nested calls run sequentially.
+thread_local bool insideParallelFor = false;
+
+/// Threads that are started on first use and shared by all subsequent calls to parallelFor,
+/// so that the optimiser does not have to start new threads for every sub-assembly or item list.
+class WorkerPool
+{
+public:
+	static WorkerPool& instance()
+	{
+		static WorkerPool pool;
+		return pool;
+	}
+
+	/// Calls @a _function for all indices in [0, _size) on the workers and the calling thread.
+	/// Runs sequentially if the pool is already in use by another thread.
+	/// Exceptions are rethrown in the calling thread.
+	void run(size_t _size, function<void(size_t)> const& _function)
+	{
+		unique_lock<mutex> runLock(m_runMutex, try_to_lock);
+		if (!runLock.owns_lock() || m_workers.empty())
+		{
+			for (size_t i = 0; i < _size; ++i)
+				_function(i);
+			return;
+		}
+
+		{
+			lock_guard<mutex> lock(m_mutex);
+			m_function = &_function;
+			m_size = _size;
+			m_next = 0;
+			m_error = nullptr;
+			m_busyWorkers = m_workers.size();
+			m_generation++;
+		}
+		m_wakeUp.notify_all();
+		work();
+
+		unique_lock<mutex> lock(m_mutex);
+		m_finished.wait(lock, [&]() { return m_busyWorkers == 0; });
+		m_function = nullptr;
+		if (m_error)
+			rethrow_exception(m_error);
+	}
+
+private:
+	WorkerPool()
+	{
+		unsigned concurrency = thread::hardware_concurrency();
+		// The calling thread also takes part in the work.
+		for (unsigned i = 1; i < concurrency; ++i)
+			m_workers.emplace_back([this]() { workerLoop(); });
+	}
+
+	~WorkerPool()
+	{
+		{
+			lock_guard<mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_wakeUp.notify_all();
+		for (auto& worker: m_workers)
+			worker.join();
+	}
+
+	void workerLoop()
+	{
+		size_t generation = 0;
+		while (true)
+		{
+			{
+				unique_lock<mutex> lock(m_mutex);
+				m_wakeUp.wait(lock, [&]() { return m_stop || m_generation != generation; });
+				if (m_stop)
+					return;
+				generation = m_generation;
+			}
+			work();
+			lock_guard<mutex> lock(m_mutex);
+			if (--m_busyWorkers == 0)
+				m_finished.notify_one();
+		}
+	}
+
+	void work()
+	{
+		insideParallelFor = true;
+		for (size_t i = m_next++; i < m_size; i = m_next++)
+			try
+			{
+				(*m_function)(i);
+			}
+			catch (...)
+			{
+				lock_guard<mutex> lock(m_mutex);
+				if (!m_error)
+					m_error = current_exception();
+				m_next = m_size;
+			}
+		insideParallelFor = false;
+	}
+
+	vector<thread> m_workers;
+	/// Held by the thread that currently distributes work.
+	mutex m_runMutex;
+	/// Protects the members below, except for m_next.
+	mutex m_mutex;
+	condition_variable m_wakeUp;
+	condition_variable m_finished;
+	bool m_stop = false;
+	size_t m_generation = 0;
+	size_t m_busyWorkers = 0;
+	function<void(size_t)> const* m_function = nullptr;
+	size_t m_size = 0;
+	atomic<size_t> m_next{0};
+	exception_ptr m_error;
+};
+
+/// Calls @a _function for all indices in [0, _size), distributed over the threads of the
+/// worker pool if @a _parallel is set, this is supported and @a _size is at least @a _minSize.
+/// Exceptions are rethrown in the calling thread.
+/// @a _function must not depend on the order in which the indices are processed.
+void parallelFor(bool _parallel, size_t _size, size_t _minSize, function<void(size_t)> const& _function)
+{
+#ifndef __EMSCRIPTEN__
+	if (_parallel && !insideParallelFor && _size >= max<size_t>(_minSize, 2))
+	{
+		WorkerPool::instance().run(_size, _function);
+		return;
+	}
+#endif
+	for (size_t i = 0; i < _size; ++i)
+		_function(i);
+}
+
+}
+
+void Assembly::collectAssemblies(set<Assembly const*>& _assemblies) const
+{
+	if (_assemblies.insert(this).second)
+		for (auto const& sub: m_subs)
+			sub->collectAssemblies(_assemblies);
+}
+
+Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(
+	frontend::OptimiserSettings const& _settings,
+	EVMVersion _evmVersion
+)
+{
+	// Constructing it this way so that we notice changes in the fields.
+	OptimiserSettings asmSettings{false, false, false, false, false, false, _evmVersion, 0, false};
+	asmSettings.isCreation = true;
+	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
+	asmSettings.runPeephole = _settings.runPeephole;
+	asmSettings.runDeduplicate = _settings.runDeduplicate;
+	asmSettings.runCSE = _settings.runCSE;
+	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
+	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
+	asmSettings.runInParallel = _settings.parallelAssemblyOptimiser;
+	return asmSettings;
+}
+
 Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 {
+	Profiler::Probe probe("evmasm/optimise");
 	optimiseInternal(_settings, {});
 	return *this;
 }
@@ -402,18 +581,36 @@ map<u256, u256> Assembly::optimiseInternal(
 )
 {
 	// Run optimisation for sub-assemblies.
+	// Sub-assemblies can be optimised concurrently, but only if they do not share any assembly
+	// (the same compiled contract can be referenced from multiple places).
+	bool subsAreDisjoint = true;
+	set<Assembly const*> reachableFromSubs;
+	for (auto const& sub: m_subs)
+	{
+		set<Assembly const*> reachable;
+		sub->collectAssemblies(reachable);
+		for (Assembly const* assembly: reachable)
+			if (!reachableFromSubs.insert(assembly).second)
+				subsAreDisjoint = false;
+	}
+	vector<set<size_t>> tagsReferencedFromSubs;
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		tagsReferencedFromSubs.emplace_back(JumpdestRemover::referencedTags(m_items, subId));
+	vector<map<u256, u256>> subTagReplacements(m_subs.size());
+	auto optimiseSub = [&](size_t _subId)
 	{
 		OptimiserSettings settings = _settings;
 		// Disable creation mode for sub-assemblies.
 		settings.isCreation = false;
-		map<u256, u256> subTagReplacements = m_subs[subId]->optimiseInternal(
+		subTagReplacements[_subId] = m_subs[_subId]->optimiseInternal(
 			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
+			move(tagsReferencedFromSubs[_subId])
 		);
-		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
-	}
+	};
+	parallelFor(_settings.runInParallel && subsAreDisjoint, m_subs.size(), 2, optimiseSub);
+	// Apply the replacements (can be empty).
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements[subId], subId);
 
 	map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
@@ -473,19 +670,30 @@ map<u256, u256> Assembly::optimiseInternal(
 
 			bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
 
-			auto iter = m_items.begin();
-			while (iter != m_items.end())
+			// The basic blocks are optimised independently of each other, so split the items
+			// first and process the blocks concurrently.
+			vector<AssemblyItems::const_iterator> blockStarts;
+			for (auto iter = m_items.cbegin(); iter != m_items.cend();)
 			{
+				blockStarts.emplace_back(iter);
+				while (iter != m_items.cend() && !SemanticInformation::breaksCSEAnalysisBlock(*iter, usesMSize))
+					++iter;
+				if (iter != m_items.cend())
+					++iter;
+			}
+			blockStarts.emplace_back(m_items.cend());
+
+			vector<optional<AssemblyItems>> optimisedBlocks(blockStarts.size() - 1);
+			parallelFor(_settings.runInParallel, optimisedBlocks.size(), 64, [&](size_t _block) {
 				KnownState emptyState;
 				CommonSubexpressionEliminator eliminator{emptyState};
-				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
-				bool shouldReplace = false;
-				AssemblyItems optimisedChunk;
+				auto iter = eliminator.feedItems(blockStarts[_block], blockStarts[_block + 1], usesMSize);
+				assertThrow(iter == blockStarts[_block + 1], OptimizerException, "");
 				try
 				{
-					optimisedChunk = eliminator.getOptimizedItems();
-					shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
+					AssemblyItems optimisedChunk = eliminator.getOptimizedItems();
+					if (optimisedChunk.size() < static_cast<size_t>(iter - blockStarts[_block]))
+						optimisedBlocks[_block] = move(optimisedChunk);
 				}
 				catch (StackTooDeepException const&)
 				{
@@ -497,15 +705,16 @@ map<u256, u256> Assembly::optimiseInternal(
 					// This might happen if e.g. associativity and commutativity rules
 					// reorganise the expression tree, but not all leaves are available.
 				}
+			});
 
-				if (shouldReplace)
+			for (size_t block = 0; block < optimisedBlocks.size(); ++block)
+				if (optimisedBlocks[block])
 				{
 					count++;
-					optimisedItems += optimisedChunk;
+					optimisedItems += *optimisedBlocks[block];
 				}
 				else
-					copy(orig, iter, back_inserter(optimisedItems));
-			}
+					copy(blockStarts[block], blockStarts[block + 1], back_inserter(optimisedItems));
 			if (optimisedItems.size() < m_items.size())
 			{
 				m_items = move(optimisedItems);
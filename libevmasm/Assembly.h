@@ -36,6 +36,11 @@
 #include <sstream>
 #include <memory>
 
+namespace solidity::frontend
+{
+struct OptimiserSettings;
+}
+
 namespace solidity::evmasm
 {
 
@@ -115,6 +120,12 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+		/// Optimise sub-assemblies and basic blocks concurrently. Does not change the result.
+		bool runInParallel = false;
+
+		/// Translates the settings of the compiler interface into settings for the top-level
+		/// (creation) assembly of the given EVM version.
+		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion _evmVersion);
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -157,6 +168,9 @@ protected:
 
 	unsigned bytesRequired(unsigned subTagSize) const;
 
+	/// Adds this assembly and all its (transitive) sub-assemblies to @a _assemblies.
+	void collectAssemblies(std::set<Assembly const*>& _assemblies) const;
+
 private:
 	static Json::Value createJsonValue(
 		std::string _name,
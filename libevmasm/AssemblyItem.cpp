@@ -330,6 +330,9 @@ std::string AssemblyItem::computeSourceMapping(
 	int prevSourceIndex = -1;
 	int prevModifierDepth = -1;
 	char prevJump = 0;
+	// Consecutive items mostly share their source, so the index is only looked up by name
+	// if the source changes.
+	CharStream const* prevSource = nullptr;
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
@@ -337,10 +340,15 @@ std::string AssemblyItem::computeSourceMapping(
 
 		SourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			location.source && _sourceIndicesMap.count(location.source->name()) ?
-			static_cast<int>(_sourceIndicesMap.at(location.source->name())) :
-			-1;
+		int sourceIndex = prevSourceIndex;
+		if (location.source.get() != prevSource || !prevSource)
+		{
+			prevSource = location.source.get();
+			sourceIndex = -1;
+			if (location.source)
+				if (auto it = _sourceIndicesMap.find(location.source->name()); it != _sourceIndicesMap.end())
+					sourceIndex = static_cast<int>(it->second);
+		}
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
@@ -27,8 +27,11 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
-#include <functional>
-#include <set>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity;
@@ -37,9 +40,6 @@ using namespace solidity::evmasm;
 
 bool BlockDeduplicator::deduplicate()
 {
-	// Compares indices based on the suffix that starts there, ignoring tags and stopping at
-	// opcodes that stop the control flow.
-
 	// Virtual tag that signifies "the current block" and which is used to optimise loops.
 	// We abort if this virtual tag actually exists.
 	AssemblyItem pushSelf{PushTag, u256(-4)};
@@ -49,46 +49,61 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
-	{
-		if (_i == _j)
-			return false;
-
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
+	using diff_type = BlockIterator::difference_type;
+	BlockIterator const end{m_items.end(), m_items.end()};
 
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag.
+	auto pushOwnTag = [&](size_t _i)
+	{
 		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
-
-		using diff_type = BlockIterator::difference_type;
-		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
-		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
-		BlockIterator end{m_items.end(), m_items.end()};
-
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
-
-		return std::lexicographical_compare(first, end, second, end);
+			return m_items.at(_i).pushTag();
+		return pushSelf;
+	};
+	// Iterator over the suffix that starts at _i, ignoring tags and stopping at
+	// opcodes that stop the control flow. _pushOwnTag has to outlive the iterator.
+	auto blockBegin = [&](size_t _i, AssemblyItem const& _pushOwnTag)
+	{
+		BlockIterator it{m_items.begin() + diff_type(_i), m_items.end(), &_pushOwnTag, &pushSelf};
+		if (it != end && (*it).type() == Tag)
+			++it;
+		return it;
+	};
+	auto blockHash = [&](size_t _i)
+	{
+		AssemblyItem pushTag = pushOwnTag(_i);
+		size_t hash = 0;
+		for (BlockIterator it = blockBegin(_i, pushTag); it != end; ++it)
+		{
+			AssemblyItem const& item = *it;
+			boost::hash_combine(hash, static_cast<int>(item.type()));
+			if (item.type() == Operation)
+				boost::hash_combine(hash, static_cast<int>(item.instruction()));
+			else
+				boost::hash_combine(hash, static_cast<size_t>(item.data() & numeric_limits<size_t>::max()));
+		}
+		return hash;
+	};
+	auto equalBlocks = [&](size_t _i, size_t _j)
+	{
+		AssemblyItem pushFirstTag = pushOwnTag(_i);
+		AssemblyItem pushSecondTag = pushOwnTag(_j);
+		return std::equal(blockBegin(_i, pushFirstTag), end, blockBegin(_j, pushSecondTag), end);
 	};
 
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		set<size_t, function<bool(size_t, size_t)>> blocksSeen(comparator);
+		// Blocks by hash, only the first block of each group of equal blocks is kept.
+		unordered_map<size_t, vector<size_t>> blocksSeen;
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
 			if (m_items.at(i).type() != Tag)
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
+			vector<size_t>& candidates = blocksSeen[blockHash(i)];
+			auto it = find_if(candidates.begin(), candidates.end(), [&](size_t _j) { return equalBlocks(i, _j); });
+			if (it == candidates.end())
+				candidates.push_back(i);
 			else
 				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
 		}
@@ -152,7 +152,7 @@ u256 const* ExpressionClasses::knownConstant(Id _c)
 {
 	map<unsigned, Expression const*> matchGroups;
 	Pattern constant(Push);
-	constant.setMatchGroup(1, matchGroups);
+	constant.setMatchGroup(1, &matchGroups);
 	if (!constant.matches(representative(_c), *this))
 		return nullptr;
 	return &constant.d();
@@ -183,7 +183,7 @@ string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	static Rules const rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
@@ -54,12 +54,13 @@ GasMeter::GasConsumption PathGasMeter::estimateMax(
 
 void PathGasMeter::queue(std::unique_ptr<GasPath>&& _newPath)
 {
-	if (
-		m_highestGasUsagePerJumpdest.count(_newPath->index) &&
-		_newPath->gas < m_highestGasUsagePerJumpdest.at(_newPath->index)
-	)
-		return;
-	m_highestGasUsagePerJumpdest[_newPath->index] = _newPath->gas;
+	auto [it, inserted] = m_highestGasUsagePerJumpdest.try_emplace(_newPath->index, _newPath->gas);
+	if (!inserted)
+	{
+		if (_newPath->gas < it->second)
+			return;
+		it->second = _newPath->gas;
+	}
 	m_queue[_newPath->index] = move(_newPath);
 }
 
@@ -119,16 +120,27 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 
 		gas += meter.estimateMax(item);
 
-		for (u256 const& tag: jumpTags)
+		for (auto it = jumpTags.begin(); it != jumpTags.end(); ++it)
 		{
+			// If the current path ends here, the last new path can take over its state
+			// instead of copying it.
+			bool reuseState = branchStops && next(it) == jumpTags.end();
 			auto newPath = make_unique<GasPath>();
 			newPath->index = m_items.size();
-			if (m_tagPositions.count(tag))
-				newPath->index = m_tagPositions.at(tag);
+			if (auto position = m_tagPositions.find(*it); position != m_tagPositions.end())
+				newPath->index = position->second;
 			newPath->gas = gas;
 			newPath->largestMemoryAccess = meter.largestMemoryAccess();
-			newPath->state = state->copy();
-			newPath->visitedJumpdests = path->visitedJumpdests;
+			if (reuseState)
+			{
+				newPath->state = state;
+				newPath->visitedJumpdests = move(path->visitedJumpdests);
+			}
+			else
+			{
+				newPath->state = state->copy();
+				newPath->visitedJumpdests = path->visitedJumpdests;
+			}
 			queue(move(newPath));
 		}
 
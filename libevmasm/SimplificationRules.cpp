@@ -38,12 +38,21 @@ using namespace solidity;
 using namespace solidity::evmasm;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/// Match groups of the patterns that do not store them in a map of their own,
+/// i.e. of the shared simplification rules.
+thread_local map<unsigned, ExpressionClasses::Expression const*> threadMatchGroups;
+
+}
+
 SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	Expression const& _expr,
 	ExpressionClasses const& _classes
-)
+) const
 {
-	resetMatchGroups();
+	threadMatchGroups.clear();
 
 	assertThrow(_expr.item, OptimizerException, "");
 	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
@@ -52,7 +61,7 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 			if (!rule.feasible || rule.feasible())
 				return &rule;
 
-		resetMatchGroups();
+		threadMatchGroups.clear();
 	}
 	return nullptr;
 }
@@ -85,13 +94,13 @@ Rules::Rules()
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(nullopt, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -104,10 +113,10 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>* _matchGroups)
 {
 	m_matchGroup = _group;
-	m_matchGroups = &_matchGroups;
+	m_matchGroups = _matchGroups;
 }
 
 bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes) const
@@ -116,9 +125,10 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
+		auto& groups = matchGroups();
+		if (!groups.count(m_matchGroup))
+			groups[m_matchGroup] = &_expr;
+		else if (groups[m_matchGroup]->id != _expr.id)
 			return false;
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
@@ -189,9 +199,14 @@ bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	auto& groups = matchGroups();
+	assertThrow(groups[m_matchGroup], OptimizerException, "");
+	return *groups[m_matchGroup];
+}
+
+map<unsigned, Pattern::Expression const*>& Pattern::matchGroups() const
+{
+	return m_matchGroups ? *m_matchGroups : threadMatchGroups;
 }
 
 u256 const& Pattern::data() const
@@ -46,6 +46,8 @@ class Pattern;
 
 /**
  * Container for all simplification rules.
+ * The rules do not change after construction and can be shared between threads,
+ * the match groups of the last match are stored per thread.
  */
 class Rules: public boost::noncopyable
 {
@@ -59,7 +61,7 @@ public:
 	SimplificationRule<Pattern> const* findFirstMatch(
 		Expression const& _expr,
 		ExpressionClasses const& _classes
-	);
+	) const;
 
 	/// Checks whether the rulelist is non-empty. This is usually enforced
 	/// by the constructor, but we had some issues with static initialization.
@@ -69,9 +71,6 @@ private:
 	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
 	void addRule(SimplificationRule<Pattern> const& _rule);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
-
-	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
@@ -105,7 +104,9 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	/// The matched expressions are stored in @a _matchGroups or, if it is not given, in a
+	/// map that is local to the current thread.
+	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>* _matchGroups = nullptr);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
 
@@ -129,6 +130,7 @@ public:
 private:
 	bool matchesBaseItem(AssemblyItem const* _item) const;
 	Expression const& matchGroupValue() const;
+	std::map<unsigned, Expression const*>& matchGroups() const;
 	u256 const& data() const;
 
 	AssemblyItemType m_type;
@@ -137,6 +139,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
+	/// Storage for the matched expressions, uses the map of the current thread if not set.
 	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
 };
 
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace solidity::langutil
 {
@@ -51,8 +52,10 @@ struct SourceLocation
 	{
 		if (!source|| !_other.source)
 			return std::make_tuple(int(!!source), start, end) < std::make_tuple(int(!!_other.source), _other.start, _other.end);
+		else if (source == _other.source)
+			return std::tie(start, end) < std::tie(_other.start, _other.end);
 		else
-			return std::make_tuple(source->name(), start, end) < std::make_tuple(_other.source->name(), _other.start, _other.end);
+			return std::tie(source->name(), start, end) < std::tie(_other.source->name(), _other.start, _other.end);
 	}
 
 	inline bool contains(SourceLocation const& _other) const
@@ -20,11 +20,11 @@
 
 #include <libsolutil/Keccak256.h>
 
-#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <array>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -52,7 +52,7 @@ SMTLib2Interface::SMTLib2Interface(
 void SMTLib2Interface::reset()
 {
 	m_accumulatedOutput.clear();
-	m_accumulatedOutput.emplace_back();
+	m_scopeStarts.clear();
 	m_variables.clear();
 	m_userSorts.clear();
 	write("(set-option :produce-models true)");
@@ -63,13 +63,15 @@ void SMTLib2Interface::reset()
 
 void SMTLib2Interface::push()
 {
-	m_accumulatedOutput.emplace_back();
+	m_scopeStarts.push_back(m_accumulatedOutput.size());
+	m_accumulatedOutput += "\n";
 }
 
 void SMTLib2Interface::pop()
 {
-	smtAssert(!m_accumulatedOutput.empty(), "");
-	m_accumulatedOutput.pop_back();
+	smtAssert(!m_scopeStarts.empty(), "");
+	m_accumulatedOutput.resize(m_scopeStarts.back());
+	m_scopeStarts.pop_back();
 }
 
 void SMTLib2Interface::declareVariable(string const& _name, SortPointer const& _sort)
@@ -115,7 +117,7 @@ void SMTLib2Interface::addAssertion(Expression const& _expr)
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> const& _expressionsToEvaluate)
 {
 	string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
+		m_accumulatedOutput +
 		checkSatAndGetValuesCommand(_expressionsToEvaluate)
 	);
 
@@ -136,6 +138,23 @@ pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> con
 	return make_pair(result, values);
 }
 
+namespace
+{
+
+/// @returns the result of @a _body applied to @a _argument, where @a _body may use its argument
+/// several times. Unless @a _argument is atomic, it is bound to a name using `let` first,
+/// so that the size of the output stays linear in the nesting depth.
+string bindArgument(string const& _argument, function<string(string const&)> const& _body)
+{
+	if (_argument.empty() || _argument.front() != '(')
+		return _body(_argument);
+	// Contains a space, so it cannot clash with any name generated from the source.
+	string const name = "|bv argument|";
+	return "(let ((" + name + " " + _argument + ")) " + _body(name) + ")";
+}
+
+}
+
 string SMTLib2Interface::toSExpr(Expression const& _expr)
 {
 	if (_expr.arguments.empty())
@@ -145,13 +164,14 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 	if (_expr.name == "int2bv")
 	{
 		size_t size = std::stoul(_expr.arguments[1].name);
-		auto arg = toSExpr(_expr.arguments.front());
 		auto int2bv = "(_ int2bv " + to_string(size) + ")";
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += string("ite ") +
-			"(>= " + arg + " 0) " +
-			"(" + int2bv + " " + arg + ") " +
-			"(bvneg (" + int2bv + " (- " + arg + ")))";
+		return bindArgument(toSExpr(_expr.arguments.front()), [&](string const& _arg) {
+			return string("(ite ") +
+				"(>= " + _arg + " 0) " +
+				"(" + int2bv + " " + _arg + ") " +
+				"(bvneg (" + int2bv + " (- " + _arg + "))))";
+		});
 	}
 	else if (_expr.name == "bv2int")
 	{
@@ -159,10 +179,9 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 		smtAssert(intSort, "");
 
 		auto arg = toSExpr(_expr.arguments.front());
-		auto nat = "(bv2nat " + arg + ")";
 
 		if (!intSort->isSigned)
-			return nat;
+			return "(bv2nat " + arg + ")";
 
 		auto bvSort = dynamic_pointer_cast<BitVectorSort>(_expr.arguments.front().sort);
 		smtAssert(bvSort, "");
@@ -170,10 +189,12 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 		auto pos = to_string(bvSort->size - 1);
 
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += string("ite ") +
-			"(= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) " +
-			nat + " " +
-			"(- (bvneg " + arg + "))";
+		return bindArgument(arg, [&](string const& _arg) {
+			return string("(ite ") +
+				"(= ((_ extract " + pos + " " + pos + ")" + _arg + ") #b0) " +
+				"(bv2nat " + _arg + ") " +
+				"(- (bvneg " + _arg + ")))";
+		});
 	}
 	else if (_expr.name == "const_array")
 	{
@@ -260,8 +281,8 @@ string SMTLib2Interface::toSmtLibSort(vector<SortPointer> const& _sorts)
 
 void SMTLib2Interface::write(string _data)
 {
-	smtAssert(!m_accumulatedOutput.empty(), "");
-	m_accumulatedOutput.back() += move(_data) + "\n";
+	m_accumulatedOutput += move(_data);
+	m_accumulatedOutput += "\n";
 }
 
 string SMTLib2Interface::checkSatAndGetValuesCommand(vector<Expression> const& _expressionsToEvaluate)
@@ -74,7 +74,10 @@ private:
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
 	std::string querySolver(std::string const& _input);
 
-	std::vector<std::string> m_accumulatedOutput;
+	/// Script for the solver, including all assertions of the currently open scopes.
+	std::string m_accumulatedOutput;
+	/// Offsets into @a m_accumulatedOutput at which the currently open scopes start.
+	std::vector<size_t> m_scopeStarts;
 	std::map<std::string, SortPointer> m_variables;
 	std::set<std::string> m_userSorts;
 
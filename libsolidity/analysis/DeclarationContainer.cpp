@@ -40,10 +40,10 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	if (auto const* visibleDeclarations = findDeclarations(*_name, hash<ASTString>{}(*_name)))
+		declarations += *visibleDeclarations;
+	if (auto it = m_invisibleDeclarations.find(*_name); it != m_invisibleDeclarations.end())
+		declarations += it->second;
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -88,7 +88,7 @@ void DeclarationContainer::activateVariable(ASTString const& _name)
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
 	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
+	declarationsEntry(_name).emplace_back(m_invisibleDeclarations.at(_name).front());
 	m_invisibleDeclarations.erase(_name);
 }
 
@@ -113,7 +113,14 @@ bool DeclarationContainer::registerDeclaration(
 	if (_update)
 	{
 		solAssert(!dynamic_cast<FunctionDefinition const*>(&_declaration), "Attempt to update function definition.");
-		m_declarations.erase(*_name);
+		auto [begin, end] = m_declarationIndex.equal_range(hash<ASTString>{}(*_name));
+		for (auto it = begin; it != end; ++it)
+			if (it->second->first == *_name)
+			{
+				m_declarations.erase(it->second);
+				m_declarationIndex.erase(it);
+				break;
+			}
 		m_invisibleDeclarations.erase(*_name);
 	}
 	else
@@ -129,7 +136,7 @@ bool DeclarationContainer::registerDeclaration(
 			m_homonymCandidates.emplace_back(*_name, _location ? _location : &_declaration.location());
 	}
 
-	vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
+	vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : declarationsEntry(*_name);
 	if (!util::contains(decls, &_declaration))
 		decls.push_back(&_declaration);
 	return true;
@@ -147,14 +154,23 @@ bool DeclarationContainer::registerDeclaration(
 vector<Declaration const*> DeclarationContainer::resolveName(ASTString const& _name, bool _recursive, bool _alsoInvisible) const
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
-	vector<Declaration const*> result;
-	if (m_declarations.count(_name))
-		result = m_declarations.at(_name);
-	if (_alsoInvisible && m_invisibleDeclarations.count(_name))
-		result += m_invisibleDeclarations.at(_name);
-	if (result.empty() && _recursive && m_enclosingContainer)
-		result = m_enclosingContainer->resolveName(_name, true, _alsoInvisible);
-	return result;
+	size_t const nameHash = hash<ASTString>{}(_name);
+	for (
+		DeclarationContainer const* container = this;
+		container;
+		container = _recursive ? container->m_enclosingContainer : nullptr
+	)
+	{
+		vector<Declaration const*> result;
+		if (auto const* declarations = container->findDeclarations(_name, nameHash))
+			result = *declarations;
+		if (_alsoInvisible)
+			if (auto it = container->m_invisibleDeclarations.find(_name); it != container->m_invisibleDeclarations.end())
+				result += it->second;
+		if (!result.empty())
+			return result;
+	}
+	return {};
 }
 
 vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
@@ -197,3 +213,20 @@ void DeclarationContainer::populateHomonyms(back_insert_iterator<Homonyms> _it)
 			_it = make_pair(location, declarations);
 	}
 }
+
+vector<Declaration const*> const* DeclarationContainer::findDeclarations(ASTString const& _name, size_t _hash) const
+{
+	auto [begin, end] = m_declarationIndex.equal_range(_hash);
+	for (auto it = begin; it != end; ++it)
+		if (it->second->first == _name)
+			return &it->second->second;
+	return nullptr;
+}
+
+vector<Declaration const*>& DeclarationContainer::declarationsEntry(ASTString const& _name)
+{
+	auto [it, inserted] = m_declarations.try_emplace(_name);
+	if (inserted)
+		m_declarationIndex.emplace(hash<ASTString>{}(_name), it);
+	return it->second;
+}
@@ -28,6 +28,9 @@
 #include <liblangutil/SourceLocation.h>
 #include <boost/noncopyable.hpp>
 
+#include <map>
+#include <unordered_map>
+
 namespace solidity::frontend
 {
 
@@ -35,7 +38,7 @@ namespace solidity::frontend
  * Container that stores mappings between names and declarations. It also contains a link to the
  * enclosing scope.
  */
-class DeclarationContainer
+class DeclarationContainer: boost::noncopyable
 {
 public:
 	using Homonyms = std::vector<std::pair<langutil::SourceLocation const*, std::vector<Declaration const*>>>;
@@ -58,6 +61,8 @@ public:
 	bool registerDeclaration(Declaration const& _declaration, ASTString const* _name, langutil::SourceLocation const* _location, bool _invisible, bool _update);
 	bool registerDeclaration(Declaration const& _declaration, bool _invisible, bool _update);
 
+	/// @returns the declarations of @a _name in this container and, if @a _recursive is true and there
+	/// are none, in the closest enclosing container that has some.
 	std::vector<Declaration const*> resolveName(ASTString const& _name, bool _recursive = false, bool _alsoInvisible = false) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
@@ -81,10 +86,20 @@ public:
 	void populateHomonyms(std::back_insert_iterator<Homonyms> _it) const;
 
 private:
+	using DeclarationMap = std::map<ASTString, std::vector<Declaration const*>>;
+
+	/// @returns the visible declarations of @a _name, whose hash is @a _hash, or nullptr if there are none.
+	std::vector<Declaration const*> const* findDeclarations(ASTString const& _name, size_t _hash) const;
+	/// Adds an entry for @a _name to m_declarations if not present and @returns it.
+	std::vector<Declaration const*>& declarationsEntry(ASTString const& _name);
+
 	ASTNode const* m_enclosingNode;
 	DeclarationContainer const* m_enclosingContainer;
 	std::vector<DeclarationContainer const*> m_innerContainers;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
+	DeclarationMap m_declarations;
+	/// Index of m_declarations by the hash of the name. Lookups along the chain of enclosing
+	/// containers only hash the name once and then probe each container by the hash value.
+	std::unordered_multimap<size_t, DeclarationMap::iterator> m_declarationIndex;
 	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
 	/// List of declarations (name and location) to check later for homonymity.
 	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
@@ -879,52 +879,58 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedFunctions.count(&_contract))
-	{
-		OverrideProxyBySignatureMultiSet result;
+	if (auto it = m_inheritedFunctions.find(&_contract); it != m_inheritedFunctions.end())
+		return it->second;
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
-			for (FunctionDefinition const* fun: base->definedFunctions())
-				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
-			for (VariableDeclaration const* var: base->stateVariables())
-				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
-
-			for (OverrideProxy const& func: inheritedFunctions(*base))
-				functionsInBase.insert(func);
-
-			result += functionsInBase;
-		}
-
-		m_inheritedFunctions[&_contract] = result;
-	}
+	OverrideProxyBySignatureMultiSet result;
+	for (auto const* base: resolveDirectBaseContracts(_contract))
+		result += functionsForDerived(*base);
 
-	return m_inheritedFunctions[&_contract];
+	return m_inheritedFunctions[&_contract] = move(result);
 }
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedModifiers.count(&_contract))
-	{
-		OverrideProxyBySignatureMultiSet result;
+	if (auto it = m_inheritedModifiers.find(&_contract); it != m_inheritedModifiers.end())
+		return it->second;
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
-			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
+	OverrideProxyBySignatureMultiSet result;
+	for (auto const* base: resolveDirectBaseContracts(_contract))
+		result += modifiersForDerived(*base);
 
-			for (OverrideProxy const& mod: inheritedModifiers(*base))
-				modifiersInBase.insert(mod);
+	return m_inheritedModifiers[&_contract] = move(result);
+}
 
-			result += modifiersInBase;
-		}
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::functionsForDerived(ContractDefinition const& _contract) const
+{
+	if (auto it = m_functionsForDerived.find(&_contract); it != m_functionsForDerived.end())
+		return it->second;
 
-		m_inheritedModifiers[&_contract] = result;
-	}
+	OverrideProxyBySignatureSet functions;
+	for (FunctionDefinition const* fun: _contract.definedFunctions())
+		if (!fun->isConstructor())
+			functions.emplace(OverrideProxy{fun});
+	for (VariableDeclaration const* var: _contract.stateVariables())
+		if (var->isPublic())
+			functions.emplace(OverrideProxy{var});
+
+	for (OverrideProxy const& func: inheritedFunctions(_contract))
+		functions.insert(func);
+
+	return m_functionsForDerived[&_contract] = move(functions);
+}
+
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::modifiersForDerived(ContractDefinition const& _contract) const
+{
+	if (auto it = m_modifiersForDerived.find(&_contract); it != m_modifiersForDerived.end())
+		return it->second;
+
+	OverrideProxyBySignatureSet modifiers;
+	for (ModifierDefinition const* mod: _contract.functionModifiers())
+		modifiers.emplace(OverrideProxy{mod});
+
+	for (OverrideProxy const& mod: inheritedModifiers(_contract))
+		modifiers.insert(mod);
 
-	return m_inheritedModifiers[&_contract];
+	return m_modifiersForDerived[&_contract] = move(modifiers);
 }
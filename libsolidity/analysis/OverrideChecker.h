@@ -134,6 +134,7 @@ class OverrideChecker
 {
 public:
 	using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
+	using OverrideProxyBySignatureSet = std::set<OverrideProxy, OverrideProxy::CompareBySignature>;
 
 	/// @param _errorReporter provides the error logging functionality.
 	explicit OverrideChecker(langutil::ErrorReporter& _errorReporter):
@@ -189,11 +190,21 @@ private:
 
 	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited);
 
+	/// @returns the functions (including public state variables) and modifiers, respectively, that
+	/// contracts deriving from @a _contract inherit from it, i.e. those defined in @a _contract
+	/// together with the ones it inherits and does not override.
+	OverrideProxyBySignatureSet const& functionsForDerived(ContractDefinition const& _contract) const;
+	OverrideProxyBySignatureSet const& modifiersForDerived(ContractDefinition const& _contract) const;
+
 	langutil::ErrorReporter& m_errorReporter;
 
 	/// Cache for inheritedFunctions().
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	/// Cache for functionsForDerived() and modifiersForDerived(). Every contract is only processed
+	/// once, so the override proxies (and their signatures) are shared by all derived contracts.
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_functionsForDerived;
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_modifiersForDerived;
 };
 
 }
@@ -168,29 +168,35 @@ vector<pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractDefinition:
 		set<string> signaturesSeen;
 		vector<pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
 
-		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
+		if (_includeInheritedFunctions)
+		{
+			// Assemble the list from the (cached) lists of the functions defined in each base,
+			// so that the function types and selectors are only computed once per contract.
+			for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
+				for (auto const& [hash, fun]: contract->interfaceFunctionList(false))
+					if (signaturesSeen.insert(fun->externalSignature()).second)
+						interfaceFunctionList.emplace_back(hash, fun);
+			return interfaceFunctionList;
+		}
+
+		vector<FunctionTypePointer> functions;
+		for (FunctionDefinition const* f: definedFunctions())
+			if (f->isPartOfExternalInterface())
+				functions.push_back(TypeProvider::function(*f, FunctionType::Kind::External));
+		for (VariableDeclaration const* v: stateVariables())
+			if (v->isPartOfExternalInterface())
+				functions.push_back(TypeProvider::function(*v));
+		for (FunctionTypePointer const& fun: functions)
 		{
-			if (_includeInheritedFunctions == false && contract != this)
+			if (!fun->interfaceFunctionType())
+				// Fails hopefully because we already registered the error
 				continue;
-			vector<FunctionTypePointer> functions;
-			for (FunctionDefinition const* f: contract->definedFunctions())
-				if (f->isPartOfExternalInterface())
-					functions.push_back(TypeProvider::function(*f, FunctionType::Kind::External));
-			for (VariableDeclaration const* v: contract->stateVariables())
-				if (v->isPartOfExternalInterface())
-					functions.push_back(TypeProvider::function(*v));
-			for (FunctionTypePointer const& fun: functions)
+			string functionSignature = fun->externalSignature();
+			if (signaturesSeen.count(functionSignature) == 0)
 			{
-				if (!fun->interfaceFunctionType())
-					// Fails hopefully because we already registered the error
-					continue;
-				string functionSignature = fun->externalSignature();
-				if (signaturesSeen.count(functionSignature) == 0)
-				{
-					signaturesSeen.insert(functionSignature);
-					util::FixedHash<4> hash(util::keccak256(functionSignature));
-					interfaceFunctionList.emplace_back(hash, fun);
-				}
+				signaturesSeen.insert(functionSignature);
+				util::FixedHash<4> hash(util::keccak256(functionSignature));
+				interfaceFunctionList.emplace_back(hash, fun);
 			}
 		}
 
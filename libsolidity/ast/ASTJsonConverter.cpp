@@ -77,31 +77,21 @@ ASTJsonConverter::ASTJsonConverter(CompilerStack::State _stackState, map<string,
 }
 
 
-void ASTJsonConverter::setJsonNode(
-	ASTNode const& _node,
-	string const& _nodeName,
-	initializer_list<pair<string, Json::Value>>&& _attributes
-)
-{
-	ASTJsonConverter::setJsonNode(
-		_node,
-		_nodeName,
-		std::vector<pair<string, Json::Value>>(std::move(_attributes))
-	);
-}
-
 void ASTJsonConverter::setJsonNode(
 	ASTNode const& _node,
 	string const& _nodeType,
 	std::vector<pair<string, Json::Value>>&& _attributes
 )
 {
+	// The keys common to all nodes are static strings, so they are not copied for every node.
 	m_currentValue = Json::objectValue;
-	m_currentValue["id"] = nodeId(_node);
-	m_currentValue["src"] = sourceLocationToString(_node.location());
-	m_currentValue["nodeType"] = _nodeType;
+	m_currentValue[Json::StaticString("id")] = nodeId(_node);
+	m_currentValue[Json::StaticString("src")] = sourceLocationToString(_node.location());
+	m_currentValue[Json::StaticString("nodeType")] = _nodeType;
 	for (auto& e: _attributes)
-		m_currentValue[e.first] = std::move(e.second);
+		// Null attributes would be removed by removeNullMembers in toJson anyway.
+		if (!e.second.isNull())
+			m_currentValue[e.first] = std::move(e.second);
 }
 
 size_t ASTJsonConverter::sourceIndexFromLocation(SourceLocation const& _location) const
@@ -152,10 +142,10 @@ void ASTJsonConverter::appendExpressionAttributes(
 	ExpressionAnnotation const& _annotation
 )
 {
-	std::vector<pair<string, Json::Value>> exprAttributes = {
+	std::vector<pair<string, Json::Value>> exprAttributes = attributeList({
 		make_pair("typeDescriptions", typePointerToJson(_annotation.type)),
 		make_pair("argumentTypes", typePointerToJson(_annotation.arguments))
-	};
+	});
 
 	addIfSet(exprAttributes, "isLValue", _annotation.isLValue);
 	addIfSet(exprAttributes, "isPure", _annotation.isPure);
@@ -164,7 +154,7 @@ void ASTJsonConverter::appendExpressionAttributes(
 	if (m_stackState > CompilerStack::State::ParsedAndImported)
 		exprAttributes.emplace_back("lValueRequested", _annotation.willBeWrittenTo);
 
-	_attributes += exprAttributes;
+	_attributes += std::move(exprAttributes);
 }
 
 Json::Value ASTJsonConverter::inlineAssemblyIdentifierToJson(pair<yul::Identifier const* ,InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const
@@ -186,17 +176,22 @@ void ASTJsonConverter::print(ostream& _stream, ASTNode const& _node)
 }
 
 Json::Value ASTJsonConverter::toJson(ASTNode const& _node)
+{
+	return util::removeNullMembers(convert(_node));
+}
+
+Json::Value ASTJsonConverter::convert(ASTNode const& _node)
 {
 	_node.accept(*this);
-	return util::removeNullMembers(std::move(m_currentValue));
+	return std::move(m_currentValue);
 }
 
 bool ASTJsonConverter::visit(SourceUnit const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("license", _node.licenseString() ? Json::Value(*_node.licenseString()) : Json::nullValue),
-		make_pair("nodes", toJson(_node.nodes()))
-	};
+		make_pair("nodes", convert(_node.nodes()))
+	});
 
 	if (_node.annotation().exportedSymbols.set())
 	{
@@ -231,11 +226,11 @@ bool ASTJsonConverter::visit(PragmaDirective const& _node)
 
 bool ASTJsonConverter::visit(ImportDirective const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("file", _node.path()),
 		make_pair("sourceUnit", idOrNull(_node.annotation().sourceUnit)),
 		make_pair("scope", idOrNull(_node.scope()))
-	};
+	});
 
 	addIfSet(attributes, "absolutePath", _node.annotation().absolutePath);
 
@@ -245,7 +240,7 @@ bool ASTJsonConverter::visit(ImportDirective const& _node)
 	{
 		Json::Value tuple(Json::objectValue);
 		solAssert(symbolAlias.symbol, "");
-		tuple["foreign"] = toJson(*symbolAlias.symbol);
+		tuple["foreign"] = convert(*symbolAlias.symbol);
 		tuple["local"] =  symbolAlias.alias ? Json::Value(*symbolAlias.alias) : Json::nullValue;
 		symbolAliases.append(tuple);
 	}
@@ -256,16 +251,16 @@ bool ASTJsonConverter::visit(ImportDirective const& _node)
 
 bool ASTJsonConverter::visit(ContractDefinition const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
-		make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json::nullValue),
+		make_pair("documentation", _node.documentation() ? convert(*_node.documentation()) : Json::nullValue),
 		make_pair("contractKind", contractKind(_node.contractKind())),
 		make_pair("abstract", _node.abstract()),
-		make_pair("baseContracts", toJson(_node.baseContracts())),
+		make_pair("baseContracts", convert(_node.baseContracts())),
 		make_pair("contractDependencies", getContainerIds(_node.annotation().contractDependencies, true)),
-		make_pair("nodes", toJson(_node.subNodes())),
+		make_pair("nodes", convert(_node.subNodes())),
 		make_pair("scope", idOrNull(_node.scope()))
-	};
+	});
 
 	if (_node.annotation().unimplementedDeclarations.has_value())
 		attributes.emplace_back("fullyImplemented", _node.annotation().unimplementedDeclarations->empty());
@@ -288,8 +283,8 @@ bool ASTJsonConverter::visit(IdentifierPath const& _node)
 bool ASTJsonConverter::visit(InheritanceSpecifier const& _node)
 {
 	setJsonNode(_node, "InheritanceSpecifier", {
-		make_pair("baseName", toJson(_node.name())),
-		make_pair("arguments", _node.arguments() ? toJson(*_node.arguments()) : Json::nullValue)
+		make_pair("baseName", convert(_node.name())),
+		make_pair("arguments", _node.arguments() ? convert(*_node.arguments()) : Json::nullValue)
 	});
 	return false;
 }
@@ -297,20 +292,20 @@ bool ASTJsonConverter::visit(InheritanceSpecifier const& _node)
 bool ASTJsonConverter::visit(UsingForDirective const& _node)
 {
 	setJsonNode(_node, "UsingForDirective", {
-		make_pair("libraryName", toJson(_node.libraryName())),
-		make_pair("typeName", _node.typeName() ? toJson(*_node.typeName()) : Json::nullValue)
+		make_pair("libraryName", convert(_node.libraryName())),
+		make_pair("typeName", _node.typeName() ? convert(*_node.typeName()) : Json::nullValue)
 	});
 	return false;
 }
 
 bool ASTJsonConverter::visit(StructDefinition const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
 		make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
-		make_pair("members", toJson(_node.members())),
+		make_pair("members", convert(_node.members())),
 		make_pair("scope", idOrNull(_node.scope()))
-	};
+	});
 
 	addIfSet(attributes,"canonicalName", _node.annotation().canonicalName);
 
@@ -321,10 +316,10 @@ bool ASTJsonConverter::visit(StructDefinition const& _node)
 
 bool ASTJsonConverter::visit(EnumDefinition const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
-		make_pair("members", toJson(_node.members()))
-	};
+		make_pair("members", convert(_node.members()))
+	});
 
 	addIfSet(attributes,"canonicalName", _node.annotation().canonicalName);
 
@@ -344,7 +339,7 @@ bool ASTJsonConverter::visit(EnumValue const& _node)
 bool ASTJsonConverter::visit(ParameterList const& _node)
 {
 	setJsonNode(_node, "ParameterList", {
-		make_pair("parameters", toJson(_node.parameters()))
+		make_pair("parameters", convert(_node.parameters()))
 	});
 	return false;
 }
@@ -352,27 +347,27 @@ bool ASTJsonConverter::visit(ParameterList const& _node)
 bool ASTJsonConverter::visit(OverrideSpecifier const& _node)
 {
 	setJsonNode(_node, "OverrideSpecifier", {
-		make_pair("overrides", toJson(_node.overrides()))
+		make_pair("overrides", convert(_node.overrides()))
 	});
 	return false;
 }
 
 bool ASTJsonConverter::visit(FunctionDefinition const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
-		make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json::nullValue),
+		make_pair("documentation", _node.documentation() ? convert(*_node.documentation()) : Json::nullValue),
 		make_pair("kind", _node.isFree() ? "freeFunction" : TokenTraits::toString(_node.kind())),
 		make_pair("stateMutability", stateMutabilityToString(_node.stateMutability())),
 		make_pair("virtual", _node.markedVirtual()),
-		make_pair("overrides", _node.overrides() ? toJson(*_node.overrides()) : Json::nullValue),
-		make_pair("parameters", toJson(_node.parameterList())),
-		make_pair("returnParameters", toJson(*_node.returnParameterList())),
-		make_pair("modifiers", toJson(_node.modifiers())),
-		make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json::nullValue),
+		make_pair("overrides", _node.overrides() ? convert(*_node.overrides()) : Json::nullValue),
+		make_pair("parameters", convert(_node.parameterList())),
+		make_pair("returnParameters", convert(*_node.returnParameterList())),
+		make_pair("modifiers", convert(_node.modifiers())),
+		make_pair("body", _node.isImplemented() ? convert(_node.body()) : Json::nullValue),
 		make_pair("implemented", _node.isImplemented()),
 		make_pair("scope", idOrNull(_node.scope()))
-	};
+	});
 
 	optional<Visibility> visibility;
 	if (_node.isConstructor())
@@ -396,23 +391,23 @@ bool ASTJsonConverter::visit(FunctionDefinition const& _node)
 
 bool ASTJsonConverter::visit(VariableDeclaration const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
-		make_pair("typeName", toJson(_node.typeName())),
+		make_pair("typeName", convert(_node.typeName())),
 		make_pair("constant", _node.isConstant()),
 		make_pair("mutability", VariableDeclaration::mutabilityToString(_node.mutability())),
 		make_pair("stateVariable", _node.isStateVariable()),
 		make_pair("storageLocation", location(_node.referenceLocation())),
-		make_pair("overrides", _node.overrides() ? toJson(*_node.overrides()) : Json::nullValue),
+		make_pair("overrides", _node.overrides() ? convert(*_node.overrides()) : Json::nullValue),
 		make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
-		make_pair("value", _node.value() ? toJson(*_node.value()) : Json::nullValue),
+		make_pair("value", _node.value() ? convert(*_node.value()) : Json::nullValue),
 		make_pair("scope", idOrNull(_node.scope())),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	};
+	});
 	if (_node.isStateVariable() && _node.isPublic())
 		attributes.emplace_back("functionSelector", _node.externalIdentifierHex());
 	if (_node.isStateVariable() && _node.documentation())
-		attributes.emplace_back("documentation", toJson(*_node.documentation()));
+		attributes.emplace_back("documentation", convert(*_node.documentation()));
 	if (m_inEvent)
 		attributes.emplace_back("indexed", _node.isIndexed());
 	if (!_node.annotation().baseFunctions.empty())
@@ -423,15 +418,15 @@ bool ASTJsonConverter::visit(VariableDeclaration const& _node)
 
 bool ASTJsonConverter::visit(ModifierDefinition const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.name()),
-		make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json::nullValue),
+		make_pair("documentation", _node.documentation() ? convert(*_node.documentation()) : Json::nullValue),
 		make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
-		make_pair("parameters", toJson(_node.parameterList())),
+		make_pair("parameters", convert(_node.parameterList())),
 		make_pair("virtual", _node.markedVirtual()),
-		make_pair("overrides", _node.overrides() ? toJson(*_node.overrides()) : Json::nullValue),
-		make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json::nullValue)
-	};
+		make_pair("overrides", _node.overrides() ? convert(*_node.overrides()) : Json::nullValue),
+		make_pair("body", _node.isImplemented() ? convert(_node.body()) : Json::nullValue)
+	});
 	if (!_node.annotation().baseFunctions.empty())
 		attributes.emplace_back(make_pair("baseModifiers", getContainerIds(_node.annotation().baseFunctions, true)));
 	setJsonNode(_node, "ModifierDefinition", std::move(attributes));
@@ -441,8 +436,8 @@ bool ASTJsonConverter::visit(ModifierDefinition const& _node)
 bool ASTJsonConverter::visit(ModifierInvocation const& _node)
 {
 	setJsonNode(_node, "ModifierInvocation", {
-		make_pair("modifierName", toJson(_node.name())),
-		make_pair("arguments", _node.arguments() ? toJson(*_node.arguments()) : Json::nullValue)
+		make_pair("modifierName", convert(_node.name())),
+		make_pair("arguments", _node.arguments() ? convert(*_node.arguments()) : Json::nullValue)
 	});
 	return false;
 }
@@ -452,8 +447,8 @@ bool ASTJsonConverter::visit(EventDefinition const& _node)
 	m_inEvent = true;
 	setJsonNode(_node, "EventDefinition", {
 		make_pair("name", _node.name()),
-		make_pair("documentation", _node.documentation() ? toJson(*_node.documentation()) : Json::nullValue),
-		make_pair("parameters", toJson(_node.parameterList())),
+		make_pair("documentation", _node.documentation() ? convert(*_node.documentation()) : Json::nullValue),
+		make_pair("parameters", convert(_node.parameterList())),
 		make_pair("anonymous", _node.isAnonymous())
 	});
 	return false;
@@ -461,10 +456,10 @@ bool ASTJsonConverter::visit(EventDefinition const& _node)
 
 bool ASTJsonConverter::visit(ElementaryTypeName const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("name", _node.typeName().toString()),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
-	};
+	});
 
 	if (_node.stateMutability())
 		attributes.emplace_back(make_pair("stateMutability", stateMutabilityToString(*_node.stateMutability())));
@@ -476,7 +471,7 @@ bool ASTJsonConverter::visit(ElementaryTypeName const& _node)
 bool ASTJsonConverter::visit(UserDefinedTypeName const& _node)
 {
 	setJsonNode(_node, "UserDefinedTypeName", {
-		make_pair("pathNode", toJson(_node.pathNode())),
+		make_pair("pathNode", convert(_node.pathNode())),
 		make_pair("referencedDeclaration", idOrNull(_node.pathNode().annotation().referencedDeclaration)),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
 	});
@@ -488,8 +483,8 @@ bool ASTJsonConverter::visit(FunctionTypeName const& _node)
 	setJsonNode(_node, "FunctionTypeName", {
 		make_pair("visibility", Declaration::visibilityToString(_node.visibility())),
 		make_pair("stateMutability", stateMutabilityToString(_node.stateMutability())),
-		make_pair("parameterTypes", toJson(*_node.parameterTypeList())),
-		make_pair("returnParameterTypes", toJson(*_node.returnParameterTypeList())),
+		make_pair("parameterTypes", convert(*_node.parameterTypeList())),
+		make_pair("returnParameterTypes", convert(*_node.returnParameterTypeList())),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
 	});
 	return false;
@@ -498,8 +493,8 @@ bool ASTJsonConverter::visit(FunctionTypeName const& _node)
 bool ASTJsonConverter::visit(Mapping const& _node)
 {
 	setJsonNode(_node, "Mapping", {
-		make_pair("keyType", toJson(_node.keyType())),
-		make_pair("valueType", toJson(_node.valueType())),
+		make_pair("keyType", convert(_node.keyType())),
+		make_pair("valueType", convert(_node.valueType())),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
 	});
 	return false;
@@ -508,8 +503,8 @@ bool ASTJsonConverter::visit(Mapping const& _node)
 bool ASTJsonConverter::visit(ArrayTypeName const& _node)
 {
 	setJsonNode(_node, "ArrayTypeName", {
-		make_pair("baseType", toJson(_node.baseType())),
-		make_pair("length", toJsonOrNull(_node.length())),
+		make_pair("baseType", convert(_node.baseType())),
+		make_pair("length", convertOrNull(_node.length())),
 		make_pair("typeDescriptions", typePointerToJson(_node.annotation().type, true))
 	});
 	return false;
@@ -543,7 +538,7 @@ bool ASTJsonConverter::visit(InlineAssembly const& _node)
 bool ASTJsonConverter::visit(Block const& _node)
 {
 	setJsonNode(_node, _node.unchecked() ? "UncheckedBlock" : "Block", {
-		make_pair("statements", toJson(_node.statements()))
+		make_pair("statements", convert(_node.statements()))
 	});
 	return false;
 }
@@ -557,9 +552,9 @@ bool ASTJsonConverter::visit(PlaceholderStatement const& _node)
 bool ASTJsonConverter::visit(IfStatement const& _node)
 {
 	setJsonNode(_node, "IfStatement", {
-		make_pair("condition", toJson(_node.condition())),
-		make_pair("trueBody", toJson(_node.trueStatement())),
-		make_pair("falseBody", toJsonOrNull(_node.falseStatement()))
+		make_pair("condition", convert(_node.condition())),
+		make_pair("trueBody", convert(_node.trueStatement())),
+		make_pair("falseBody", convertOrNull(_node.falseStatement()))
 	});
 	return false;
 }
@@ -568,8 +563,8 @@ bool ASTJsonConverter::visit(TryCatchClause const& _node)
 {
 	setJsonNode(_node, "TryCatchClause", {
 		make_pair("errorName", _node.errorName()),
-		make_pair("parameters", toJsonOrNull(_node.parameters())),
-		make_pair("block", toJson(_node.block()))
+		make_pair("parameters", convertOrNull(_node.parameters())),
+		make_pair("block", convert(_node.block()))
 	});
 	return false;
 }
@@ -577,8 +572,8 @@ bool ASTJsonConverter::visit(TryCatchClause const& _node)
 bool ASTJsonConverter::visit(TryStatement const& _node)
 {
 	setJsonNode(_node, "TryStatement", {
-		make_pair("externalCall", toJson(_node.externalCall())),
-		make_pair("clauses", toJson(_node.clauses()))
+		make_pair("externalCall", convert(_node.externalCall())),
+		make_pair("clauses", convert(_node.clauses()))
 	});
 	return false;
 }
@@ -589,8 +584,8 @@ bool ASTJsonConverter::visit(WhileStatement const& _node)
 		_node,
 		_node.isDoWhile() ? "DoWhileStatement" : "WhileStatement",
 		{
-			make_pair("condition", toJson(_node.condition())),
-			make_pair("body", toJson(_node.body()))
+			make_pair("condition", convert(_node.condition())),
+			make_pair("body", convert(_node.body()))
 		}
 	);
 	return false;
@@ -599,10 +594,10 @@ bool ASTJsonConverter::visit(WhileStatement const& _node)
 bool ASTJsonConverter::visit(ForStatement const& _node)
 {
 	setJsonNode(_node, "ForStatement", {
-		make_pair("initializationExpression", toJsonOrNull(_node.initializationExpression())),
-		make_pair("condition", toJsonOrNull(_node.condition())),
-		make_pair("loopExpression", toJsonOrNull(_node.loopExpression())),
-		make_pair("body", toJson(_node.body()))
+		make_pair("initializationExpression", convertOrNull(_node.initializationExpression())),
+		make_pair("condition", convertOrNull(_node.condition())),
+		make_pair("loopExpression", convertOrNull(_node.loopExpression())),
+		make_pair("body", convert(_node.body()))
 	});
 	return false;
 }
@@ -622,7 +617,7 @@ bool ASTJsonConverter::visit(Break const& _node)
 bool ASTJsonConverter::visit(Return const& _node)
 {
 	setJsonNode(_node, "Return", {
-		make_pair("expression", toJsonOrNull(_node.expression())),
+		make_pair("expression", convertOrNull(_node.expression())),
 		make_pair("functionReturnParameters", idOrNull(_node.annotation().functionReturnParameters))
 	});
 	return false;
@@ -637,7 +632,7 @@ bool ASTJsonConverter::visit(Throw const& _node)
 bool ASTJsonConverter::visit(EmitStatement const& _node)
 {
 	setJsonNode(_node, "EmitStatement", {
-		make_pair("eventCall", toJson(_node.eventCall()))
+		make_pair("eventCall", convert(_node.eventCall()))
 	});
 	return false;
 }
@@ -649,8 +644,8 @@ bool ASTJsonConverter::visit(VariableDeclarationStatement const& _node)
 		appendMove(varDecs, idOrNull(v.get()));
 	setJsonNode(_node, "VariableDeclarationStatement", {
 		make_pair("assignments", std::move(varDecs)),
-		make_pair("declarations", toJson(_node.declarations())),
-		make_pair("initialValue", toJsonOrNull(_node.initialValue()))
+		make_pair("declarations", convert(_node.declarations())),
+		make_pair("initialValue", convertOrNull(_node.initialValue()))
 	});
 	return false;
 }
@@ -658,18 +653,18 @@ bool ASTJsonConverter::visit(VariableDeclarationStatement const& _node)
 bool ASTJsonConverter::visit(ExpressionStatement const& _node)
 {
 	setJsonNode(_node, "ExpressionStatement", {
-		make_pair("expression", toJson(_node.expression()))
+		make_pair("expression", convert(_node.expression()))
 	});
 	return false;
 }
 
 bool ASTJsonConverter::visit(Conditional const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("condition", toJson(_node.condition())),
-		make_pair("trueExpression", toJson(_node.trueExpression())),
-		make_pair("falseExpression", toJson(_node.falseExpression()))
-	};
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("condition", convert(_node.condition())),
+		make_pair("trueExpression", convert(_node.trueExpression())),
+		make_pair("falseExpression", convert(_node.falseExpression()))
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Conditional", std::move(attributes));
 	return false;
@@ -677,11 +672,11 @@ bool ASTJsonConverter::visit(Conditional const& _node)
 
 bool ASTJsonConverter::visit(Assignment const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("operator", TokenTraits::toString(_node.assignmentOperator())),
-		make_pair("leftHandSide", toJson(_node.leftHandSide())),
-		make_pair("rightHandSide", toJson(_node.rightHandSide()))
-	};
+		make_pair("leftHandSide", convert(_node.leftHandSide())),
+		make_pair("rightHandSide", convert(_node.rightHandSide()))
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Assignment", std::move(attributes));
 	return false;
@@ -689,10 +684,10 @@ bool ASTJsonConverter::visit(Assignment const& _node)
 
 bool ASTJsonConverter::visit(TupleExpression const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("isInlineArray", Json::Value(_node.isInlineArray())),
-		make_pair("components", toJson(_node.components())),
-	};
+		make_pair("components", convert(_node.components())),
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "TupleExpression", std::move(attributes));
 	return false;
@@ -700,11 +695,11 @@ bool ASTJsonConverter::visit(TupleExpression const& _node)
 
 bool ASTJsonConverter::visit(UnaryOperation const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("prefix", _node.isPrefixOperation()),
 		make_pair("operator", TokenTraits::toString(_node.getOperator())),
-		make_pair("subExpression", toJson(_node.subExpression()))
-	};
+		make_pair("subExpression", convert(_node.subExpression()))
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "UnaryOperation", std::move(attributes));
 	return false;
@@ -712,12 +707,12 @@ bool ASTJsonConverter::visit(UnaryOperation const& _node)
 
 bool ASTJsonConverter::visit(BinaryOperation const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("operator", TokenTraits::toString(_node.getOperator())),
-		make_pair("leftExpression", toJson(_node.leftExpression())),
-		make_pair("rightExpression", toJson(_node.rightExpression())),
+		make_pair("leftExpression", convert(_node.leftExpression())),
+		make_pair("rightExpression", convert(_node.rightExpression())),
 		make_pair("commonType", typePointerToJson(_node.annotation().commonType)),
-	};
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "BinaryOperation", std::move(attributes));
 	return false;
@@ -728,12 +723,12 @@ bool ASTJsonConverter::visit(FunctionCall const& _node)
 	Json::Value names(Json::arrayValue);
 	for (auto const& name: _node.names())
 		names.append(Json::Value(*name));
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("expression", toJson(_node.expression())),
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("expression", convert(_node.expression())),
 		make_pair("names", std::move(names)),
-		make_pair("arguments", toJson(_node.arguments())),
+		make_pair("arguments", convert(_node.arguments())),
 		make_pair("tryCall", _node.annotation().tryCall)
-	};
+	});
 
 	if (_node.annotation().kind.set())
 	{
@@ -752,11 +747,11 @@ bool ASTJsonConverter::visit(FunctionCallOptions const& _node)
 	for (auto const& name: _node.names())
 		names.append(Json::Value(*name));
 
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("expression", toJson(_node.expression())),
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("expression", convert(_node.expression())),
 		make_pair("names", std::move(names)),
-		make_pair("options", toJson(_node.options())),
-	};
+		make_pair("options", convert(_node.options())),
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 
 	setJsonNode(_node, "FunctionCallOptions", std::move(attributes));
@@ -765,9 +760,9 @@ bool ASTJsonConverter::visit(FunctionCallOptions const& _node)
 
 bool ASTJsonConverter::visit(NewExpression const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("typeName", toJson(_node.typeName()))
-	};
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("typeName", convert(_node.typeName()))
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "NewExpression", std::move(attributes));
 	return false;
@@ -775,11 +770,11 @@ bool ASTJsonConverter::visit(NewExpression const& _node)
 
 bool ASTJsonConverter::visit(MemberAccess const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("memberName", _node.memberName()),
-		make_pair("expression", toJson(_node.expression())),
+		make_pair("expression", convert(_node.expression())),
 		make_pair("referencedDeclaration", idOrNull(_node.annotation().referencedDeclaration)),
-	};
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "MemberAccess", std::move(attributes));
 	return false;
@@ -787,10 +782,10 @@ bool ASTJsonConverter::visit(MemberAccess const& _node)
 
 bool ASTJsonConverter::visit(IndexAccess const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("baseExpression", toJson(_node.baseExpression())),
-		make_pair("indexExpression", toJsonOrNull(_node.indexExpression())),
-	};
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("baseExpression", convert(_node.baseExpression())),
+		make_pair("indexExpression", convertOrNull(_node.indexExpression())),
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "IndexAccess", std::move(attributes));
 	return false;
@@ -798,11 +793,11 @@ bool ASTJsonConverter::visit(IndexAccess const& _node)
 
 bool ASTJsonConverter::visit(IndexRangeAccess const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("baseExpression", toJson(_node.baseExpression())),
-		make_pair("startExpression", toJsonOrNull(_node.startExpression())),
-		make_pair("endExpression", toJsonOrNull(_node.endExpression())),
-	};
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("baseExpression", convert(_node.baseExpression())),
+		make_pair("startExpression", convertOrNull(_node.startExpression())),
+		make_pair("endExpression", convertOrNull(_node.endExpression())),
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "IndexRangeAccess", std::move(attributes));
 	return false;
@@ -825,9 +820,9 @@ bool ASTJsonConverter::visit(Identifier const& _node)
 
 bool ASTJsonConverter::visit(ElementaryTypeNameExpression const& _node)
 {
-	std::vector<pair<string, Json::Value>> attributes = {
-		make_pair("typeName", toJson(_node.type()))
-	};
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
+		make_pair("typeName", convert(_node.type()))
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "ElementaryTypeNameExpression", std::move(attributes));
 	return false;
@@ -839,7 +834,7 @@ bool ASTJsonConverter::visit(Literal const& _node)
 	if (!util::validateUTF8(_node.value()))
 		value = Json::nullValue;
 	Token subdenomination = Token(_node.subDenomination());
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("kind", literalTokenKind(_node.token())),
 		make_pair("value", value),
 		make_pair("hexValue", util::toHex(util::asBytes(_node.value()))),
@@ -849,7 +844,7 @@ bool ASTJsonConverter::visit(Literal const& _node)
 			Json::nullValue :
 			Json::Value{TokenTraits::toString(subdenomination)}
 		)
-	};
+	});
 	appendExpressionAttributes(attributes, _node.annotation());
 	setJsonNode(_node, "Literal", std::move(attributes));
 	return false;
@@ -858,9 +853,9 @@ bool ASTJsonConverter::visit(Literal const& _node)
 bool ASTJsonConverter::visit(StructuredDocumentation const& _node)
 {
 	Json::Value text{*_node.text()};
-	std::vector<pair<string, Json::Value>> attributes = {
+	std::vector<pair<string, Json::Value>> attributes = attributeList({
 		make_pair("text", text)
-	};
+	});
 	setJsonNode(_node, "StructuredDocumentation", std::move(attributes));
 	return false;
 }
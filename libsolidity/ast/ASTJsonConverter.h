@@ -60,17 +60,6 @@ public:
 	/// Output the json representation of the AST to _stream.
 	void print(std::ostream& _stream, ASTNode const& _node);
 	Json::Value toJson(ASTNode const& _node);
-	template <class T>
-	Json::Value toJson(std::vector<ASTPointer<T>> const& _nodes)
-	{
-		Json::Value ret(Json::arrayValue);
-		for (auto const& n: _nodes)
-			if (n)
-				appendMove(ret, toJson(*n));
-			else
-				ret.append(Json::nullValue);
-		return ret;
-	}
 	bool visit(SourceUnit const& _node) override;
 	bool visit(PragmaDirective const& _node) override;
 	bool visit(ImportDirective const& _node) override;
@@ -127,11 +116,42 @@ public:
 	void endVisit(EventDefinition const&) override;
 
 private:
+	/// Converts the given node without removing null members, which is only done once for the
+	/// whole tree in toJson.
+	Json::Value convert(ASTNode const& _node);
+	template <class T>
+	Json::Value convert(std::vector<ASTPointer<T>> const& _nodes)
+	{
+		Json::Value ret(Json::arrayValue);
+		for (auto const& n: _nodes)
+			if (n)
+				appendMove(ret, convert(*n));
+			else
+				ret.append(Json::nullValue);
+		return ret;
+	}
+	/// Moves the attributes of a braced list into a vector. In contrast to an initializer list,
+	/// the elements are not const and thus the (possibly large) values are not deep-copied.
+	template <size_t N>
+	static std::vector<std::pair<std::string, Json::Value>> attributeList(
+		std::pair<std::string, Json::Value>(&&_attributes)[N]
+	)
+	{
+		std::vector<std::pair<std::string, Json::Value>> attributes;
+		attributes.reserve(N);
+		for (auto& attribute: _attributes)
+			attributes.emplace_back(std::move(attribute));
+		return attributes;
+	}
+	template <size_t N>
 	void setJsonNode(
 		ASTNode const& _node,
 		std::string const& _nodeName,
-		std::initializer_list<std::pair<std::string, Json::Value>>&& _attributes
-	);
+		std::pair<std::string, Json::Value>(&&_attributes)[N]
+	)
+	{
+		setJsonNode(_node, _nodeName, attributeList(std::move(_attributes)));
+	}
 	void setJsonNode(
 		ASTNode const& _node,
 		std::string const& _nodeName,
@@ -144,9 +164,9 @@ private:
 	{
 		return _pt ? Json::Value(nodeId(*_pt)) : Json::nullValue;
 	}
-	Json::Value toJsonOrNull(ASTNode const* _node)
+	Json::Value convertOrNull(ASTNode const* _node)
 	{
-		return _node ? toJson(*_node) : Json::nullValue;
+		return _node ? convert(*_node) : Json::nullValue;
 	}
 	Json::Value inlineAssemblyIdentifierToJson(std::pair<yul::Identifier const* , InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const;
 	static std::string location(VariableDeclaration::Location _location);
@@ -400,6 +400,10 @@ void CompilerContext::appendInlineAssembly(
 	for (auto const& var: _localVariables)
 		externallyUsedIdentifiers.insert(yul::YulString(var));
 
+	optional<langutil::SourceLocation> locationOverride;
+	if (!_system)
+		locationOverride = m_asm->currentSourceLocation();
+
 	yul::ExternalIdentifierAccess identifierAccess;
 	identifierAccess.resolve = [&](
 		yul::Identifier const& _identifier,
@@ -426,7 +430,7 @@ void CompilerContext::appendInlineAssembly(
 		if (stackDiff < 1 || stackDiff > 16)
 			BOOST_THROW_EXCEPTION(
 				StackTooDeepError() <<
-				errinfo_sourceLocation(_identifier.location) <<
+				errinfo_sourceLocation(locationOverride ? *locationOverride : _identifier.location) <<
 				util::errinfo_comment("Stack too deep (" + to_string(stackDiff) + "), try removing local variables.")
 			);
 		if (_context == yul::IdentifierContext::RValue)
@@ -440,17 +444,7 @@ void CompilerContext::appendInlineAssembly(
 
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
-	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
 	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
-	optional<langutil::SourceLocation> locationOverride;
-	if (!_system)
-		locationOverride = m_asm->currentSourceLocation();
-	shared_ptr<yul::Block> parserResult =
-		yul::Parser(errorReporter, dialect, std::move(locationOverride))
-		.parse(scanner, false);
-#ifdef SOL_OUTPUT_ASM
-	cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
-#endif
 
 	auto reportError = [&](string const& _context)
 	{
@@ -467,25 +461,52 @@ void CompilerContext::appendInlineAssembly(
 		solAssert(false, message);
 	};
 
-	yul::AsmAnalysisInfo analysisInfo;
-	bool analyzerResult = false;
-	if (parserResult)
-		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
-			errorReporter,
-			dialect,
-			identifierAccess.resolve
-		).analyze(*parserResult);
-	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
-		reportError("Invalid assembly generated by code generator.");
-
 	// Several optimizer steps cannot handle externally supplied stack variables,
 	// so we essentially only optimize the ABI functions.
-	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
+	bool const optimize = _optimiserSettings.runYulOptimiser && _localVariables.empty();
+
+	// The same snippets (panics, reverts, cleanup and conversion code) are generated over and over
+	// again. Unless the optimiser modifies the code, we parse and analyze each of them only once
+	// and apply the source location override during code generation instead of during parsing.
+	auto& parsedInlineAssembly = m_runtimeContext ? m_runtimeContext->m_parsedInlineAssembly : m_parsedInlineAssembly;
+	auto cacheKey = make_tuple(_assembly, _localVariables, _sourceName);
+	shared_ptr<yul::Block> parserResult;
+	shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+	if (!optimize)
+		if (auto it = parsedInlineAssembly.find(cacheKey); it != parsedInlineAssembly.end())
+			tie(parserResult, analysisInfo) = it->second;
+
+	if (!parserResult)
+	{
+		auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
+		parserResult =
+			yul::Parser(errorReporter, dialect, optimize ? locationOverride : nullopt)
+			.parse(scanner, false);
+#ifdef SOL_OUTPUT_ASM
+		cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
+#endif
+
+		analysisInfo = make_shared<yul::AsmAnalysisInfo>();
+		bool analyzerResult = false;
+		if (parserResult)
+			analyzerResult = yul::AsmAnalyzer(
+				*analysisInfo,
+				errorReporter,
+				dialect,
+				identifierAccess.resolve
+			).analyze(*parserResult);
+		if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
+			reportError("Invalid assembly generated by code generator.");
+
+		if (!optimize)
+			parsedInlineAssembly[cacheKey] = {parserResult, analysisInfo};
+	}
+
+	if (optimize)
 	{
 		yul::Object obj;
 		obj.code = parserResult;
-		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
+		obj.analysisInfo = analysisInfo;
 
 		optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
 
@@ -495,13 +516,15 @@ void CompilerContext::appendInlineAssembly(
 			solAssert(m_generatedYulUtilityCode.empty(), "");
 			m_generatedYulUtilityCode = yul::AsmPrinter(dialect)(*obj.code);
 			string code = yul::AsmPrinter{dialect}(*obj.code);
-			scanner = make_shared<langutil::Scanner>(langutil::CharStream(m_generatedYulUtilityCode, _sourceName));
+			auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(m_generatedYulUtilityCode, _sourceName));
 			obj.code = yul::Parser(errorReporter, dialect).parse(scanner, false);
 			*obj.analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(dialect, obj);
 		}
 
-		analysisInfo = std::move(*obj.analysisInfo);
+		analysisInfo = std::move(obj.analysisInfo);
 		parserResult = std::move(obj.code);
+		// The location override has already been applied by the parser.
+		locationOverride.reset();
 
 #ifdef SOL_OUTPUT_ASM
 		cout << "After optimizer:" << endl;
@@ -521,12 +544,13 @@ void CompilerContext::appendInlineAssembly(
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
 	yul::CodeGenerator::assemble(
 		*parserResult,
-		analysisInfo,
+		*analysisInfo,
 		*m_asm,
 		m_evmVersion,
 		identifierAccess,
 		_system,
-		_optimiserSettings.optimizeStackAllocation
+		_optimiserSettings.optimizeStackAllocation,
+		locationOverride
 	);
 
 	// Reset the source location to the one of the node (instead of the CODEGEN source location)
@@ -567,21 +591,6 @@ void CompilerContext::updateSourceLocation()
 	m_asm->setSourceLocation(m_visitedNodes.empty() ? SourceLocation() : m_visitedNodes.top()->location());
 }
 
-evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
-{
-	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, m_evmVersion, 0};
-	asmSettings.isCreation = true;
-	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
-	asmSettings.runPeephole = _settings.runPeephole;
-	asmSettings.runDeduplicate = _settings.runDeduplicate;
-	asmSettings.runCSE = _settings.runCSE;
-	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
-	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
-	asmSettings.evmVersion = m_evmVersion;
-	return asmSettings;
-}
-
 evmasm::AssemblyItem CompilerContext::FunctionCompilationQueue::entryLabel(
 	Declaration const& _declaration,
 	CompilerContext& _context
@@ -45,6 +45,7 @@
 #include <ostream>
 #include <stack>
 #include <queue>
+#include <tuple>
 #include <utility>
 
 namespace solidity::frontend {
@@ -278,7 +279,7 @@ public:
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
 	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(evmasm::Assembly::OptimiserSettings::translateSettings(_settings, m_evmVersion)); }
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
@@ -309,8 +310,6 @@ private:
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
-	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
-
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
 	 * compiled in a specific order.
@@ -382,6 +381,12 @@ private:
 	/// Generated Yul code used as utility. Source references from the bytecode can point here.
 	/// Produced from @a m_yulFunctionCollector.
 	std::string m_generatedYulUtilityCode;
+	/// Parsed and analyzed inline assembly snippets, keyed by code, local variables and source name.
+	/// Only the one of the runtime context is used, so that it is shared with the creation context.
+	std::map<
+		std::tuple<std::string, std::vector<std::string>, std::string>,
+		std::pair<std::shared_ptr<yul::Block>, std::shared_ptr<yul::AsmAnalysisInfo>>
+	> m_parsedInlineAssembly;
 	/// Container for ABI functions to be generated.
 	ABIFunctions m_abiFunctions;
 	/// Container for Yul Util functions to be generated.
@@ -29,6 +29,7 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
+#include <libsolidity/interface/IRCache.h>
 
 #include <libyul/AssemblyStack.h>
 #include <libyul/Utilities.h>
@@ -55,7 +56,24 @@ pair<string, string> IRGenerator::run(
 {
 	string const ir = yul::reindent(generate(_contract, _otherYulSources));
 
+	string warning =
+		"/*******************************************************\n"
+		" *                       WARNING                       *\n"
+		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+		" *       It can result in LOSS OF FUNDS or worse       *\n"
+		" *                !USE AT YOUR OWN RISK!               *\n"
+		" *******************************************************/\n\n";
+
+	optional<h256> cacheKey;
+	if (m_cache)
+	{
+		cacheKey = IRCache::key(ir, m_evmVersion, m_optimiserSettings);
+		if (optional<string> optimisedIR = m_cache->optimisedIR(*cacheKey))
+			return {warning + ir, warning + *optimisedIR};
+	}
+
 	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+	asmStack.setOptimisedObjectCache(m_objectCache);
 	if (!asmStack.parseAndAnalyze("", ir))
 	{
 		string errorMessage;
@@ -65,15 +83,11 @@ pair<string, string> IRGenerator::run(
 	}
 	asmStack.optimize();
 
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
+	string optimisedIR = asmStack.print();
+	if (cacheKey)
+		m_cache->storeOptimisedIR(*cacheKey, optimisedIR);
 
-	return {warning + ir, warning + asmStack.print()};
+	return {warning + ir, warning + optimisedIR};
 }
 
 string IRGenerator::generate(
@@ -28,12 +28,19 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+class OptimisedObjectCache;
+}
+
 namespace solidity::frontend
 {
 
 class SourceUnit;
+class IRCache;
 
 class IRGenerator
 {
@@ -41,16 +48,22 @@ public:
 	IRGenerator(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		OptimiserSettings _optimiserSettings
+		OptimiserSettings _optimiserSettings,
+		IRCache* _cache = nullptr,
+		std::shared_ptr<yul::OptimisedObjectCache> _objectCache = nullptr
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
+		m_cache(_cache),
+		m_objectCache(std::move(_objectCache)),
 		m_context(_evmVersion, _revertStrings, std::move(_optimiserSettings)),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
 	{}
 
 	/// Generates and returns the IR code, in unoptimized and optimized form
 	/// (or just pretty-printed, depending on the optimizer settings).
+	/// If a cache was provided and already contains the unoptimized code, the optimized
+	/// form is taken from there.
 	std::pair<std::string, std::string> run(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
@@ -114,6 +127,9 @@ private:
 
 	langutil::EVMVersion const m_evmVersion;
 	OptimiserSettings const m_optimiserSettings;
+	IRCache* m_cache = nullptr;
+	/// Cache of optimised Yul objects shared with the other contracts of the compilation.
+	std::shared_ptr<yul::OptimisedObjectCache> m_objectCache;
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
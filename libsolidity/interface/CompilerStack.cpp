@@ -49,6 +49,7 @@
 #include <libsolidity/interface/ABI.h>
 #include <libsolidity/interface/Natspec.h>
 #include <libsolidity/interface/GasEstimator.h>
+#include <libsolidity/interface/IRCache.h>
 #include <libsolidity/interface/StorageLayout.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/parsing/Parser.h>
@@ -61,6 +62,7 @@
 #include <libyul/AssemblyStack.h>
 #include <libyul/AsmParser.h>
 #include <libyul/AST.h>
+#include <libyul/optimiser/OptimisedObjectCache.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
@@ -70,6 +72,7 @@
 #include <libsolutil/SwarmHash.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Profiler.h>
 
 #include <json/json.h>
 
@@ -139,6 +142,13 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setIRCache(shared_ptr<IRCache> _cache)
+{
+	if (m_stackState >= ParsedAndImported)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set IR cache before parsing."));
+	m_irCache = move(_cache);
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -217,11 +227,13 @@ void CompilerStack::reset(bool _keepSettings)
 	m_sources.clear();
 	m_smtlib2Responses.clear();
 	m_unhandledSMTLib2Queries.clear();
+	m_optimisedObjectCache.reset();
 	if (!_keepSettings)
 	{
 		m_remappings.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_irCache.reset();
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
@@ -256,6 +268,7 @@ bool CompilerStack::parse()
 	if (m_stackState != SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
 	m_errorReporter.clear();
+	util::Profiler::Probe probe("parsing");
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
@@ -326,6 +339,7 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported || m_stackState >= AnalysisPerformed)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call analyze only after parsing was performed."));
+	util::Profiler::Probe probe("analysis/scoper");
 	resolveImports();
 
 	for (Source const* source: m_sourceOrder)
@@ -336,16 +350,19 @@ bool CompilerStack::analyze()
 
 	try
 	{
+		probe.next("analysis/syntaxChecker");
 		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
 				noErrors = false;
 
+		probe.next("analysis/docStringTagParser");
 		DocStringTagParser DocStringTagParser(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !DocStringTagParser.parseDocStrings(*source->ast))
 				noErrors = false;
 
+		probe.next("analysis/nameAndTypeResolver");
 		m_globalContext = make_shared<GlobalContext>();
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
@@ -366,6 +383,7 @@ bool CompilerStack::analyze()
 			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
 				return false;
 
+		probe.next("analysis/declarationTypeChecker");
 		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !declarationTypeChecker.check(*source->ast))
@@ -375,6 +393,7 @@ bool CompilerStack::analyze()
 		// contract or function level.
 		// This also calculates whether a contract is abstract, which is needed by the
 		// type checker.
+		probe.next("analysis/contractLevelChecker");
 		ContractLevelChecker contractLevelChecker(m_errorReporter);
 
 		for (Source const* source: m_sourceOrder)
@@ -382,6 +401,7 @@ bool CompilerStack::analyze()
 				noErrors = contractLevelChecker.check(*sourceAst);
 
 		// Requires ContractLevelChecker
+		probe.next("analysis/docStringAnalyser");
 		DocStringAnalyser docStringAnalyser(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
@@ -394,6 +414,7 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
+		probe.next("analysis/typeChecker");
 		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
@@ -402,6 +423,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Checks that can only be done when all types of all AST nodes are known.
+			probe.next("analysis/postTypeChecker");
 			PostTypeChecker postTypeChecker(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !postTypeChecker.check(*source->ast))
@@ -413,16 +435,20 @@ bool CompilerStack::analyze()
 		// Check that immutable variables are never read in c'tors and assigned
 		// exactly once
 		if (noErrors)
+		{
+			probe.next("analysis/immutableValidator");
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 						if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
 							ImmutableValidator(m_errorReporter, *contract).analyze();
+		}
 
 		if (noErrors)
 		{
 			// Control flow graph generator and analyzer. It can check for issues such as
 			// variable is used before it is assigned to.
+			probe.next("analysis/controlFlowAnalyzer");
 			CFG cfg(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !cfg.constructFlow(*source->ast))
@@ -440,6 +466,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Checks for common mistakes. Only generates warnings.
+			probe.next("analysis/staticAnalyzer");
 			StaticAnalyzer staticAnalyzer(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !staticAnalyzer.analyze(*source->ast))
@@ -449,6 +476,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Check for state mutability in every function.
+			probe.next("analysis/viewPureChecker");
 			vector<ASTPointer<ASTNode>> ast;
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
@@ -460,6 +488,7 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
+			probe.next("analysis/modelChecker");
 			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_modelCheckerSettings, m_readFile, m_enabledSMTSolvers);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
@@ -533,6 +562,7 @@ bool CompilerStack::compile(State _stopAfter)
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	m_optimisedObjectCache = make_shared<yul::OptimisedObjectCache>();
 
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
@@ -542,16 +572,28 @@ bool CompilerStack::compile(State _stopAfter)
 					try
 					{
 						if (m_viaIR || m_generateIR || m_generateEwasm)
+						{
+							util::Profiler::Probe probe("codegen/generateIR");
 							generateIR(*contract);
+						}
 						if (m_generateEvmBytecode)
 						{
 							if (m_viaIR)
+							{
+								util::Profiler::Probe probe("codegen/generateEVMFromIR");
 								generateEVMFromIR(*contract);
+							}
 							else
+							{
+								util::Profiler::Probe probe("codegen/compileContract");
 								compileContract(*contract, otherCompilers);
+							}
 						}
 						if (m_generateEwasm)
+						{
+							util::Profiler::Probe probe("codegen/generateEwasm");
 							generateEwasm(*contract);
+						}
 					}
 					catch (Error const& _error)
 					{
@@ -583,6 +625,7 @@ bool CompilerStack::compile(State _stopAfter)
 							throw;
 					}
 				}
+	m_optimisedObjectCache.reset();
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -1273,7 +1316,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, m_irCache.get(), m_optimisedObjectCache);
 	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract, otherYulSources);
 }
 
@@ -1291,20 +1334,39 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
-	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	stack.optimize();
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+	optional<h256> cacheKey;
+	IRCache::Bytecode const* cachedBytecode = nullptr;
+	if (m_irCache)
+	{
+		cacheKey = IRCache::key(compiledContract.yulIROptimized, m_evmVersion, m_optimiserSettings);
+		cachedBytecode = m_irCache->bytecode(*cacheKey);
+	}
 
-	// TODO: support passing metadata
-	// TODO: use stack.assemble here!
-	yul::MachineAssemblyObject init;
-	yul::MachineAssemblyObject runtime;
-	std::tie(init, runtime) = stack.assembleAndGuessRuntime();
-	compiledContract.object = std::move(*init.bytecode);
-	compiledContract.runtimeObject = std::move(*runtime.bytecode);
+	if (cachedBytecode)
+	{
+		compiledContract.object = cachedBytecode->creation;
+		compiledContract.runtimeObject = cachedBytecode->runtime;
+	}
+	else
+	{
+		// Re-parse the Yul IR in EVM dialect
+		yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+		stack.setOptimisedObjectCache(m_optimisedObjectCache);
+		stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+		stack.optimize();
+
+		//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+
+		// TODO: support passing metadata
+		// TODO: use stack.assemble here!
+		yul::MachineAssemblyObject init;
+		yul::MachineAssemblyObject runtime;
+		std::tie(init, runtime) = stack.assembleAndGuessRuntime();
+		compiledContract.object = std::move(*init.bytecode);
+		compiledContract.runtimeObject = std::move(*runtime.bytecode);
+		if (cacheKey)
+			m_irCache->storeBytecode(*cacheKey, {compiledContract.object, compiledContract.runtimeObject});
+	}
 	// TODO: refactor assemblyItems, runtimeAssemblyItems, generatedSources,
 	//       assemblyString, assemblyJSON, and functionEntryPoints to work with this code path
 
@@ -1455,6 +1517,8 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+			if (m_optimiserSettings.runEVMAssemblyOptimiser)
+				details["yulDetails"]["evmasmOptimizer"] = true;
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps;
 		}
 
@@ -66,6 +66,11 @@ class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 }
 
+namespace solidity::yul
+{
+class OptimisedObjectCache;
+}
+
 namespace solidity::frontend
 {
 
@@ -73,6 +78,7 @@ namespace solidity::frontend
 class ASTNode;
 class ContractDefinition;
 class FunctionDefinition;
+class IRCache;
 class SourceUnit;
 class Compiler;
 class GlobalContext;
@@ -166,6 +172,12 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets a cache for the optimised IR and the bytecode generated from it, which can be
+	/// shared with other instances. Contracts whose IR is found in the cache are neither
+	/// parsed nor optimised again by the IR pipeline.
+	/// Must be set before parsing.
+	void setIRCache(std::shared_ptr<IRCache> _cache);
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -467,6 +479,9 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	std::shared_ptr<IRCache> m_irCache;
+	/// Optimised Yul objects shared between all contracts of the current compilation.
+	std::shared_ptr<yul::OptimisedObjectCache> m_optimisedObjectCache;
 	langutil::EVMVersion m_evmVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
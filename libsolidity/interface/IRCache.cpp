@@ -0,0 +1,252 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/IRCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::evmasm;
+using namespace solidity::frontend;
+
+namespace
+{
+
+/// @returns true if @a _hash is a hex number with prefix that fits into 256 bits.
+bool isImmutableHash(string const& _hash)
+{
+	return _hash.size() > 2 && _hash.size() <= 66 && isValidHex(_hash);
+}
+
+Json::Value linkerObjectToJson(LinkerObject const& _object)
+{
+	Json::Value result{Json::objectValue};
+	result["bytecode"] = toHex(_object.bytecode);
+	result["linkReferences"] = Json::arrayValue;
+	for (auto const& [offset, name]: _object.linkReferences)
+	{
+		Json::Value reference{Json::arrayValue};
+		reference.append(Json::UInt64(offset));
+		reference.append(name);
+		result["linkReferences"].append(move(reference));
+	}
+	result["immutableReferences"] = Json::arrayValue;
+	for (auto const& [hash, immutable]: _object.immutableReferences)
+	{
+		Json::Value reference{Json::arrayValue};
+		reference.append(toHex(hash, HexPrefix::Add));
+		reference.append(immutable.first);
+		Json::Value offsets{Json::arrayValue};
+		for (size_t offset: immutable.second)
+			offsets.append(Json::UInt64(offset));
+		reference.append(move(offsets));
+		result["immutableReferences"].append(move(reference));
+	}
+	return result;
+}
+
+/// @returns the linker object stored in @a _json or nullopt if it is malformed.
+/// Throws BadHexCharacter if the bytecode is not a hex string.
+optional<LinkerObject> linkerObjectFromJson(Json::Value const& _json)
+{
+	if (
+		!_json.isObject() ||
+		!_json["bytecode"].isString() ||
+		!_json["linkReferences"].isArray() ||
+		!_json["immutableReferences"].isArray()
+	)
+		return nullopt;
+
+	LinkerObject result;
+	result.bytecode = fromHex(_json["bytecode"].asString(), WhenError::Throw);
+	for (auto const& reference: _json["linkReferences"])
+	{
+		if (!reference.isArray() || reference.size() != 2 || !reference[0].isUInt64() || !reference[1].isString())
+			return nullopt;
+		result.linkReferences[reference[0].asUInt64()] = reference[1].asString();
+	}
+	for (auto const& reference: _json["immutableReferences"])
+	{
+		if (
+			!reference.isArray() ||
+			reference.size() != 3 ||
+			!reference[0].isString() ||
+			!isImmutableHash(reference[0].asString()) ||
+			!reference[1].isString() ||
+			!reference[2].isArray()
+		)
+			return nullopt;
+		auto& immutable = result.immutableReferences[u256(reference[0].asString())];
+		immutable.first = reference[1].asString();
+		for (auto const& offset: reference[2])
+		{
+			if (!offset.isUInt64())
+				return nullopt;
+			immutable.second.push_back(offset.asUInt64());
+		}
+	}
+	return result;
+}
+
+}
+
+IRCache::IRCache(boost::filesystem::path _directory):
+	m_directory(move(_directory))
+{
+	boost::system::error_code error;
+	boost::filesystem::create_directories(m_directory, error);
+}
+
+h256 IRCache::key(
+	string const& _ir,
+	langutil::EVMVersion _evmVersion,
+	OptimiserSettings const& _optimiserSettings
+)
+{
+	string settings = VersionString + ":" + _evmVersion.name() + ":" + _optimiserSettings.toString() + ":";
+	return keccak256(settings + _ir);
+}
+
+optional<string> IRCache::optimisedIR(h256 const& _key) const
+{
+	auto it = m_optimisedIR.find(_key);
+	if (it == m_optimisedIR.end())
+		if (optional<string> content = readFile(_key, "yul"))
+			it = m_optimisedIR.emplace(_key, move(*content)).first;
+	if (it == m_optimisedIR.end())
+	{
+		m_misses++;
+		return nullopt;
+	}
+	m_hits++;
+	return it->second;
+}
+
+void IRCache::storeOptimisedIR(h256 const& _key, string _optimisedIR)
+{
+	writeFile(_key, "yul", _optimisedIR);
+	m_optimisedIR[_key] = move(_optimisedIR);
+}
+
+IRCache::Bytecode const* IRCache::bytecode(h256 const& _key) const
+{
+	auto it = m_bytecode.find(_key);
+	if (it == m_bytecode.end())
+		if (optional<string> content = readFile(_key, "json"))
+		{
+			// The files are not trusted, a malformed entry is treated as a cache miss.
+			Json::Value json;
+			if (jsonParseStrict(*content, json))
+				try
+				{
+					optional<LinkerObject> creation = linkerObjectFromJson(json["creation"]);
+					optional<LinkerObject> runtime = linkerObjectFromJson(json["runtime"]);
+					if (creation && runtime)
+						it = m_bytecode.emplace(_key, Bytecode{move(*creation), move(*runtime)}).first;
+				}
+				catch (BadHexCharacter const&)
+				{
+				}
+				catch (runtime_error const&)
+				{
+				}
+		}
+	if (it == m_bytecode.end())
+	{
+		m_misses++;
+		return nullptr;
+	}
+	m_hits++;
+	return &it->second;
+}
+
+void IRCache::storeBytecode(h256 const& _key, Bytecode _bytecode)
+{
+	if (!m_directory.empty())
+	{
+		Json::Value json{Json::objectValue};
+		json["creation"] = linkerObjectToJson(_bytecode.creation);
+		json["runtime"] = linkerObjectToJson(_bytecode.runtime);
+		writeFile(_key, "json", jsonCompactPrint(json));
+	}
+	m_bytecode[_key] = move(_bytecode);
+}
+
+void IRCache::clear()
+{
+	m_optimisedIR.clear();
+	m_bytecode.clear();
+	m_hits = 0;
+	m_misses = 0;
+}
+
+optional<string> IRCache::readFile(h256 const& _key, string const& _extension) const
+{
+	if (m_directory.empty())
+		return nullopt;
+	boost::filesystem::path path = m_directory / (_key.hex() + "." + _extension);
+	boost::system::error_code error;
+	if (!boost::filesystem::is_regular_file(path, error))
+		return nullopt;
+	try
+	{
+		return readFileAsString(path.string());
+	}
+	catch (FileNotFound const&)
+	{
+		return nullopt;
+	}
+}
+
+void IRCache::writeFile(h256 const& _key, string const& _extension, string const& _content) const
+{
+	if (m_directory.empty())
+		return;
+	// Write to a temporary file first, so that concurrent compiler runs sharing the
+	// directory never read a partially written entry.
+	boost::filesystem::path path = m_directory / (_key.hex() + "." + _extension);
+	boost::system::error_code error;
+	boost::filesystem::path temporaryPath = boost::filesystem::unique_path(path.string() + ".%%%%%%%%", error);
+	if (error)
+		return;
+	{
+		ofstream file(temporaryPath.string(), ios::binary);
+		file << _content;
+		if (!file)
+		{
+			boost::filesystem::remove(temporaryPath, error);
+			return;
+		}
+	}
+	boost::filesystem::rename(temporaryPath, path, error);
+	if (error)
+		boost::filesystem::remove(temporaryPath, error);
+}
@@ -0,0 +1,104 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of optimising and assembling the Yul IR of contracts.
+ */
+
+#pragma once
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <libevmasm/LinkerObject.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Stores the optimised IR and the bytecode produced from the IR of contracts, keyed by
+ * the hash of the input IR together with all settings that influence the result.
+ * It can be shared between several CompilerStack instances, so that contracts whose IR
+ * did not change since a previous compilation are neither parsed nor optimised again.
+ *
+ * If a directory is given, every entry is also written to a file in that directory named
+ * after its key, and entries that are not in memory are looked up there. This way, the
+ * results are re-used across compiler invocations. The version of the compiler is part
+ * of the key, so a directory can be shared between compiler versions.
+ *
+ * Entries are never evicted, neither from memory nor from the directory.
+ */
+class IRCache: boost::noncopyable
+{
+public:
+	IRCache() = default;
+	/// Creates a cache that persists its entries in @a _directory, which is created if needed.
+	explicit IRCache(boost::filesystem::path _directory);
+
+	struct Bytecode
+	{
+		evmasm::LinkerObject creation;
+		evmasm::LinkerObject runtime;
+	};
+
+	/// @returns the key under which the results of compiling @a _ir with the given settings are stored.
+	static util::h256 key(
+		std::string const& _ir,
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings const& _optimiserSettings
+	);
+
+	/// @returns the optimised version of the IR stored under @a _key, if present.
+	std::optional<std::string> optimisedIR(util::h256 const& _key) const;
+	void storeOptimisedIR(util::h256 const& _key, std::string _optimisedIR);
+
+	/// @returns the creation and runtime bytecode assembled from the IR stored under @a _key, if present.
+	Bytecode const* bytecode(util::h256 const& _key) const;
+	void storeBytecode(util::h256 const& _key, Bytecode _bytecode);
+
+	size_t hits() const { return m_hits; }
+	size_t misses() const { return m_misses; }
+
+	/// Removes all entries from memory and resets the statistics. Files in the cache directory are kept.
+	void clear();
+
+private:
+	/// @returns the contents of the file for @a _key with the given extension in the cache directory,
+	/// if there is a cache directory and the file exists.
+	std::optional<std::string> readFile(util::h256 const& _key, std::string const& _extension) const;
+	/// Writes the file for @a _key with the given extension to the cache directory, if any.
+	/// Failures are ignored, since the entry is still available in memory.
+	void writeFile(util::h256 const& _key, std::string const& _extension, std::string const& _content) const;
+
+	boost::filesystem::path m_directory;
+	mutable std::map<util::h256, std::string> m_optimisedIR;
+	mutable std::map<util::h256, Bytecode> m_bytecode;
+	mutable size_t m_hits = 0;
+	mutable size_t m_misses = 0;
+};
+
+}
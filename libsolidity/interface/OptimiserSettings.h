@@ -24,6 +24,7 @@
 #pragma once
 
 #include <cstddef>
+#include <initializer_list>
 #include <string>
 
 namespace solidity::frontend
@@ -93,11 +94,34 @@ struct OptimiserSettings
 			runCSE == _other.runCSE &&
 			runConstantOptimiser == _other.runConstantOptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
+			runEVMAssemblyOptimiser == _other.runEVMAssemblyOptimiser &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
 			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
 	}
 
+	/// @returns a compact representation of all settings that is equal for two settings
+	/// objects if and only if they compare equal. Used as part of cache keys.
+	std::string toString() const
+	{
+		std::string result;
+		for (bool flag: {
+			runOrderLiterals,
+			runJumpdestRemover,
+			runPeephole,
+			runDeduplicate,
+			runCSE,
+			runConstantOptimiser,
+			optimizeStackAllocation,
+			runEVMAssemblyOptimiser,
+			runYulOptimiser
+		})
+			result += flag ? '1' : '0';
+		result += ":" + std::to_string(expectedExecutionsPerDeployment);
+		result += ":" + yulOptimiserSteps;
+		return result;
+	}
+
 	/// Move literals to the right of commutative binary operators during code generation.
 	/// This helps exploiting associativity.
 	bool runOrderLiterals = false;
@@ -114,6 +138,12 @@ struct OptimiserSettings
 	bool runConstantOptimiser = false;
 	/// Perform more efficient stack allocation for variables during code generation from Yul to bytecode.
 	bool optimizeStackAllocation = false;
+	/// Run the enabled evmasm optimisation steps (see above) also on the assembly generated from Yul.
+	/// Code generated from Yul is otherwise assembled without any of them.
+	bool runEVMAssemblyOptimiser = false;
+	/// Run the evmasm optimiser on independent sub-assemblies and basic blocks on several threads.
+	/// Does not change the generated code and is therefore not part of comparisons and cache keys.
+	bool parallelAssemblyOptimiser = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
 	/// Sequence of optimisation steps to be performed by Yul optimiser.
@@ -73,6 +73,7 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		bool profiling = false;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
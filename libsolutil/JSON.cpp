@@ -29,6 +29,7 @@
 #include <sstream>
 #include <map>
 #include <memory>
+#include <vector>
 
 using namespace std;
 
@@ -95,14 +96,17 @@ void removeNullMembersHelper(Json::Value& _json)
 		for (auto& child: _json)
 			removeNullMembersHelper(child);
 	else if (_json.type() == Json::ValueType::objectValue)
-		for (auto const& key: _json.getMemberNames())
-		{
-			Json::Value& value = _json[key];
-			if (value.isNull())
-				_json.removeMember(key);
+	{
+		// Only collect the names of the members to be removed, most members are not null.
+		vector<string> nullMembers;
+		for (auto it = _json.begin(); it != _json.end(); ++it)
+			if (it->isNull())
+				nullMembers.emplace_back(it.name());
 			else
-				removeNullMembersHelper(value);
-		}
+				removeNullMembersHelper(*it);
+		for (auto const& key: nullMembers)
+			_json.removeMember(key);
+	}
 }
 
 } // end anonymous namespace
@@ -0,0 +1,128 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Profiler.h>
+
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+using namespace std;
+using namespace std::chrono;
+using namespace solidity;
+using namespace solidity::util;
+
+atomic<bool> Profiler::s_enabled{false};
+
+namespace
+{
+
+mutex g_entriesMutex;
+
+map<string, Profiler::Entry>& g_entries()
+{
+	static map<string, Profiler::Entry> entries;
+	return entries;
+}
+
+}
+
+Profiler::Probe::Probe(string _phase):
+	m_enabled(Profiler::enabled())
+{
+	if (m_enabled)
+	{
+		m_phase = move(_phase);
+		m_start = steady_clock::now();
+	}
+}
+
+Profiler::Probe::~Probe()
+{
+	stop();
+}
+
+void Profiler::Probe::next(string _phase)
+{
+	stop();
+	if (m_enabled)
+	{
+		m_phase = move(_phase);
+		m_start = steady_clock::now();
+	}
+}
+
+void Profiler::Probe::stop()
+{
+	if (m_enabled)
+		Profiler::record(m_phase, duration_cast<nanoseconds>(steady_clock::now() - m_start));
+}
+
+void Profiler::reset()
+{
+	lock_guard<mutex> lock(g_entriesMutex);
+	g_entries().clear();
+}
+
+void Profiler::record(string const& _phase, nanoseconds _time, optional<int64_t> _codeSizeDelta)
+{
+	lock_guard<mutex> lock(g_entriesMutex);
+	Entry& entry = g_entries()[_phase];
+	entry.time += _time;
+	entry.count++;
+	if (_codeSizeDelta)
+		entry.codeSizeDelta = entry.codeSizeDelta.value_or(0) + *_codeSizeDelta;
+}
+
+map<string, Profiler::Entry> Profiler::entries()
+{
+	lock_guard<mutex> lock(g_entriesMutex);
+	return g_entries();
+}
+
+Json::Value Profiler::toJson()
+{
+	Json::Value ret{Json::objectValue};
+	for (auto const& [phase, entry]: entries())
+	{
+		Json::Value& output = ret[phase];
+		output["time"] = Json::Int64(duration_cast<microseconds>(entry.time).count());
+		output["count"] = Json::UInt64(entry.count);
+		if (entry.codeSizeDelta)
+			output["codeSizeDelta"] = Json::Int64(*entry.codeSizeDelta);
+	}
+	return ret;
+}
+
+string Profiler::toString()
+{
+	ostringstream ret;
+	ret << left << setw(48) << "Phase" << right << setw(12) << "Time (ms)" << setw(10) << "Count" << setw(16) << "Code size delta" << endl;
+	for (auto const& [phase, entry]: entries())
+	{
+		ret << left << setw(48) << phase << right << fixed << setprecision(3) << setw(12);
+		ret << static_cast<double>(duration_cast<microseconds>(entry.time).count()) / 1000.0;
+		ret << setw(10) << entry.count << setw(16);
+		if (entry.codeSizeDelta)
+			ret << *entry.codeSizeDelta;
+		else
+			ret << "";
+		ret << endl;
+	}
+	return ret.str();
+}
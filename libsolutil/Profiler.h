@@ -0,0 +1,101 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Collection of the time spent in the individual phases of the compiler.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace solidity::util
+{
+
+/**
+ * Process-wide collection of wall-clock times of named compiler phases.
+ * Disabled by default, in which case measuring a phase only costs a single check.
+ *
+ * Usage:
+ *
+ *   Profiler::Probe probe("analysis/typeChecker");
+ *   ...
+ *   probe.next("analysis/postTypeChecker");
+ *   ...
+ */
+class Profiler
+{
+public:
+	struct Entry
+	{
+		std::chrono::nanoseconds time{0};
+		size_t count = 0;
+		/// Accumulated change of the code size, if the phase reported one.
+		std::optional<int64_t> codeSizeDelta;
+	};
+
+	/// Measures the time from its construction (or the last call to next()) until its
+	/// destruction and adds it to the entry of the current phase.
+	class Probe
+	{
+	public:
+		explicit Probe(std::string _phase);
+		~Probe();
+		Probe(Probe const&) = delete;
+		Probe& operator=(Probe const&) = delete;
+
+		/// Ends measuring the current phase and starts measuring @a _phase.
+		void next(std::string _phase);
+
+	private:
+		void stop();
+
+		std::string m_phase;
+		std::chrono::steady_clock::time_point m_start;
+		bool m_enabled = false;
+	};
+
+	static bool enabled() { return s_enabled; }
+	/// Enables or disables profiling. Does not clear the collected entries.
+	static void setEnabled(bool _enabled) { s_enabled = _enabled; }
+	static void reset();
+
+	/// Adds @a _time to the entry of @a _phase.
+	static void record(
+		std::string const& _phase,
+		std::chrono::nanoseconds _time,
+		std::optional<int64_t> _codeSizeDelta = std::nullopt
+	);
+
+	static std::map<std::string, Entry> entries();
+	/// @returns the collected entries as JSON object, with times in microseconds.
+	static Json::Value toJson();
+	/// @returns the collected entries as human-readable table.
+	static std::string toString();
+
+private:
+	static std::atomic<bool> s_enabled;
+};
+
+}
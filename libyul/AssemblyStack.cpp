@@ -23,6 +23,7 @@
 
 #include <libyul/AssemblyStack.h>
 
+#include <libyul/AST.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmParser.h>
@@ -37,6 +38,7 @@
 #include <libyul/backends/wasm/WasmObjectCompiler.h>
 #include <libyul/backends/wasm/EVMToEwasmTranslator.h>
 #include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/OptimisedObjectCache.h>
 #include <libyul/ObjectParser.h>
 #include <libyul/optimiser/Suite.h>
 
@@ -45,6 +47,8 @@
 #include <libevmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
 
+#include <optional>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -177,6 +181,25 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 			optimize(*subObject, false);
 
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
+
+	// The execution profile refers to source locations, which are not part of the cache key.
+	optional<util::h256> cacheKey;
+	vector<SourceLocation> unoptimisedLocations;
+	if (m_optimisedObjectCache && !m_executionProfile)
+	{
+		string settings = m_evmVersion.name() + ":" + to_string(static_cast<int>(m_language));
+		settings += ":" + to_string(_isCreation);
+		settings += ":" + m_optimiserSettings.toString();
+		cacheKey = OptimisedObjectCache::key(_object, dialect, settings);
+		if (optional<Block> optimisedCode = m_optimisedObjectCache->optimisedCode(*cacheKey, *_object.code))
+		{
+			*_object.code = move(*optimisedCode);
+			*_object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(dialect, _object);
+			return;
+		}
+		unoptimisedLocations = OptimisedObjectCache::sourceLocations(*_object.code);
+	}
+
 	unique_ptr<GasMeter> meter;
 	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
 		meter = make_unique<GasMeter>(*evmDialect, _isCreation, m_optimiserSettings.expectedExecutionsPerDeployment);
@@ -185,8 +208,12 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		meter.get(),
 		_object,
 		m_optimiserSettings.optimizeStackAllocation,
-		m_optimiserSettings.yulOptimiserSteps
+		m_optimiserSettings.yulOptimiserSteps,
+		{},
+		m_executionProfile.get()
 	);
+	if (cacheKey)
+		m_optimisedObjectCache->store(*cacheKey, move(unoptimisedLocations), *_object.code);
 }
 
 MachineAssemblyObject AssemblyStack::assemble(Machine _machine) const
@@ -236,6 +263,8 @@ pair<MachineAssemblyObject, MachineAssemblyObject> AssemblyStack::assembleAndGue
 	evmasm::Assembly assembly;
 	EthAssemblyAdapter adapter(assembly);
 	compileEVM(adapter, false, m_optimiserSettings.optimizeStackAllocation);
+	if (m_optimiserSettings.runEVMAssemblyOptimiser)
+		assembly.optimise(evmasm::Assembly::OptimiserSettings::translateSettings(m_optimiserSettings, m_evmVersion));
 
 	MachineAssemblyObject creationObject;
 	creationObject.bytecode = make_shared<evmasm::LinkerObject>(assembly.assemble());
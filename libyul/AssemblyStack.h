@@ -43,6 +43,8 @@ class Scanner;
 namespace solidity::yul
 {
 class AbstractAssembly;
+class ExecutionProfile;
+class OptimisedObjectCache;
 
 
 struct MachineAssemblyObject
@@ -79,6 +81,14 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Sets execution counts of the functions in the source (e.g. recorded by the Yul
+	/// interpreter) to guide the optimizer.
+	void setExecutionProfile(std::shared_ptr<ExecutionProfile const> _profile) { m_executionProfile = std::move(_profile); }
+
+	/// Sets a cache of optimised objects that is shared with other assembly stacks, so that
+	/// objects that were already optimised with the same settings are not optimised again.
+	void setOptimisedObjectCache(std::shared_ptr<OptimisedObjectCache> _cache) { m_optimisedObjectCache = std::move(_cache); }
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
@@ -115,6 +125,8 @@ private:
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
+	std::shared_ptr<ExecutionProfile const> m_executionProfile;
+	std::shared_ptr<OptimisedObjectCache> m_optimisedObjectCache;
 
 	std::shared_ptr<langutil::Scanner> m_scanner;
 
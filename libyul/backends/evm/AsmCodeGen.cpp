@@ -44,14 +44,18 @@ using namespace solidity::yul;
 using namespace solidity::util;
 using namespace solidity::langutil;
 
-EthAssemblyAdapter::EthAssemblyAdapter(evmasm::Assembly& _assembly):
-	m_assembly(_assembly)
+EthAssemblyAdapter::EthAssemblyAdapter(
+	evmasm::Assembly& _assembly,
+	optional<SourceLocation> _sourceLocationOverride
+):
+	m_assembly(_assembly),
+	m_sourceLocationOverride(move(_sourceLocationOverride))
 {
 }
 
 void EthAssemblyAdapter::setSourceLocation(SourceLocation const& _location)
 {
-	m_assembly.setSourceLocation(_location);
+	m_assembly.setSourceLocation(m_sourceLocationOverride ? *m_sourceLocationOverride : _location);
 }
 
 int EthAssemblyAdapter::stackHeight() const
@@ -144,7 +148,7 @@ pair<shared_ptr<AbstractAssembly>, AbstractAssembly::SubID> EthAssemblyAdapter::
 {
 	shared_ptr<evmasm::Assembly> assembly{make_shared<evmasm::Assembly>()};
 	auto sub = m_assembly.newSub(assembly);
-	return {make_shared<EthAssemblyAdapter>(*assembly), static_cast<size_t>(sub.data())};
+	return {make_shared<EthAssemblyAdapter>(*assembly, m_sourceLocationOverride), static_cast<size_t>(sub.data())};
 }
 
 void EthAssemblyAdapter::appendDataOffset(vector<AbstractAssembly::SubID> const& _subPath)
@@ -227,10 +231,11 @@ void CodeGenerator::assemble(
 	langutil::EVMVersion _evmVersion,
 	ExternalIdentifierAccess const& _identifierAccess,
 	bool _useNamedLabelsForFunctions,
-	bool _optimizeStackAllocation
+	bool _optimizeStackAllocation,
+	optional<SourceLocation> const& _sourceLocationOverride
 )
 {
-	EthAssemblyAdapter assemblyAdapter(_assembly);
+	EthAssemblyAdapter assemblyAdapter(_assembly, _sourceLocationOverride);
 	BuiltinContext builtinContext;
 	CodeTransform transform(
 		assemblyAdapter,
@@ -25,6 +25,7 @@
 #include <libyul/AsmAnalysis.h>
 #include <liblangutil/SourceLocation.h>
 #include <functional>
+#include <optional>
 
 namespace solidity::evmasm
 {
@@ -39,7 +40,12 @@ struct Block;
 class EthAssemblyAdapter: public AbstractAssembly
 {
 public:
-	explicit EthAssemblyAdapter(evmasm::Assembly& _assembly);
+	/// @param _sourceLocationOverride if set, used as source location for all generated items
+	/// instead of the locations of the AST nodes.
+	explicit EthAssemblyAdapter(
+		evmasm::Assembly& _assembly,
+		std::optional<langutil::SourceLocation> _sourceLocationOverride = {}
+	);
 	void setSourceLocation(langutil::SourceLocation const& _location) override;
 	int stackHeight() const override;
 	void setStackHeight(int height) override;
@@ -72,6 +78,7 @@ private:
 	void appendJumpInstruction(evmasm::Instruction _instruction, JumpType _jumpType);
 
 	evmasm::Assembly& m_assembly;
+	std::optional<langutil::SourceLocation> m_sourceLocationOverride;
 	std::map<SubID, u256> m_dataHashBySubId;
 	size_t m_nextDataCounter = std::numeric_limits<size_t>::max() / 2;
 };
@@ -80,6 +87,8 @@ class CodeGenerator
 {
 public:
 	/// Performs code generation and appends generated to _assembly.
+	/// If @a _sourceLocationOverride is set, it is used for all generated items instead
+	/// of the source locations stored in @a _parsedData.
 	static void assemble(
 		Block const& _parsedData,
 		AsmAnalysisInfo& _analysisInfo,
@@ -87,7 +96,8 @@ public:
 		langutil::EVMVersion _evmVersion,
 		ExternalIdentifierAccess const& _identifierAccess = ExternalIdentifierAccess(),
 		bool _useNamedLabelsForFunctions = false,
-		bool _optimizeStackAllocation = false
+		bool _optimizeStackAllocation = false,
+		std::optional<langutil::SourceLocation> const& _sourceLocationOverride = {}
 	);
 };
 
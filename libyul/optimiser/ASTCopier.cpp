@@ -34,13 +34,13 @@ using namespace solidity::util;
 
 Statement ASTCopier::operator()(ExpressionStatement const& _statement)
 {
-	return ExpressionStatement{ _statement.location, translate(_statement.expression) };
+	return ExpressionStatement{ translateLocation(_statement.location), translate(_statement.expression) };
 }
 
 Statement ASTCopier::operator()(VariableDeclaration const& _varDecl)
 {
 	return VariableDeclaration{
-		_varDecl.location,
+		translateLocation(_varDecl.location),
 		translateVector(_varDecl.variables),
 		translate(_varDecl.value)
 	};
@@ -49,7 +49,7 @@ Statement ASTCopier::operator()(VariableDeclaration const& _varDecl)
 Statement ASTCopier::operator()(Assignment const& _assignment)
 {
 	return Assignment{
-		_assignment.location,
+		translateLocation(_assignment.location),
 		translateVector(_assignment.variableNames),
 		translate(_assignment.value)
 	};
@@ -58,7 +58,7 @@ Statement ASTCopier::operator()(Assignment const& _assignment)
 Expression ASTCopier::operator()(FunctionCall const& _call)
 {
 	return FunctionCall{
-		_call.location,
+		translateLocation(_call.location),
 		translate(_call.functionName),
 		translateVector(_call.arguments)
 	};
@@ -76,12 +76,12 @@ Expression ASTCopier::operator()(Literal const& _literal)
 
 Statement ASTCopier::operator()(If const& _if)
 {
-	return If{_if.location, translate(_if.condition), translate(_if.body)};
+	return If{translateLocation(_if.location), translate(_if.condition), translate(_if.body)};
 }
 
 Statement ASTCopier::operator()(Switch const& _switch)
 {
-	return Switch{_switch.location, translate(_switch.expression), translateVector(_switch.cases)};
+	return Switch{translateLocation(_switch.location), translate(_switch.expression), translateVector(_switch.cases)};
 }
 
 Statement ASTCopier::operator()(FunctionDefinition const& _function)
@@ -92,7 +92,7 @@ Statement ASTCopier::operator()(FunctionDefinition const& _function)
 	ScopeGuard g([&]() { this->leaveFunction(_function); });
 
 	return FunctionDefinition{
-		_function.location,
+		translateLocation(_function.location),
 		translatedName,
 		translateVector(_function.parameters),
 		translateVector(_function.returnVariables),
@@ -106,7 +106,7 @@ Statement ASTCopier::operator()(ForLoop const& _forLoop)
 	ScopeGuard g([&]() { this->leaveScope(_forLoop.pre); });
 
 	return ForLoop{
-		_forLoop.location,
+		translateLocation(_forLoop.location),
 		translate(_forLoop.pre),
 		translate(_forLoop.condition),
 		translate(_forLoop.post),
@@ -115,17 +115,17 @@ Statement ASTCopier::operator()(ForLoop const& _forLoop)
 }
 Statement ASTCopier::operator()(Break const& _break)
 {
-	return Break{ _break };
+	return Break{ translateLocation(_break.location) };
 }
 
 Statement ASTCopier::operator()(Continue const& _continue)
 {
-	return Continue{ _continue };
+	return Continue{ translateLocation(_continue.location) };
 }
 
 Statement ASTCopier::operator()(Leave const& _leaveStatement)
 {
-	return Leave{_leaveStatement};
+	return Leave{translateLocation(_leaveStatement.location)};
 }
 
 Statement ASTCopier::operator ()(Block const& _block)
@@ -148,26 +148,26 @@ Block ASTCopier::translate(Block const& _block)
 	enterScope(_block);
 	ScopeGuard g([&]() { this->leaveScope(_block); });
 
-	return Block{_block.location, translateVector(_block.statements)};
+	return Block{translateLocation(_block.location), translateVector(_block.statements)};
 }
 
 Case ASTCopier::translate(Case const& _case)
 {
-	return Case{_case.location, translate(_case.value), translate(_case.body)};
+	return Case{translateLocation(_case.location), translate(_case.value), translate(_case.body)};
 }
 
 Identifier ASTCopier::translate(Identifier const& _identifier)
 {
-	return Identifier{_identifier.location, translateIdentifier(_identifier.name)};
+	return Identifier{translateLocation(_identifier.location), translateIdentifier(_identifier.name)};
 }
 
 Literal ASTCopier::translate(Literal const& _literal)
 {
-	return _literal;
+	return Literal{translateLocation(_literal.location), _literal.kind, _literal.value, _literal.type};
 }
 
 TypedName ASTCopier::translate(TypedName const& _typedName)
 {
-	return TypedName{_typedName.location, translateIdentifier(_typedName.name), _typedName.type};
+	return TypedName{translateLocation(_typedName.location), translateIdentifier(_typedName.name), _typedName.type};
 }
 
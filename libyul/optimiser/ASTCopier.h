@@ -25,6 +25,8 @@
 
 #include <libyul/YulString.h>
 
+#include <liblangutil/SourceLocation.h>
+
 #include <memory>
 #include <optional>
 #include <set>
@@ -106,12 +108,14 @@ protected:
 	virtual void enterFunction(FunctionDefinition const&) { }
 	virtual void leaveFunction(FunctionDefinition const&) { }
 	virtual YulString translateIdentifier(YulString _name) { return _name; }
+	virtual langutil::SourceLocation translateLocation(langutil::SourceLocation const& _location) { return _location; }
 };
 
 template <typename T>
 std::vector<T> ASTCopier::translateVector(std::vector<T> const& _values)
 {
 	std::vector<T> translated;
+	translated.reserve(_values.size());
 	for (auto const& v: _values)
 		translated.emplace_back(translate(v));
 	return translated;
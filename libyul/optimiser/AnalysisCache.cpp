@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/AnalysisCache.h>
+
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
+
+#include <libsolutil/Profiler.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+CallGraph const& AnalysisCache::callGraph(Block const& _ast)
+{
+	validateFor(_ast);
+	if (!m_callGraph)
+	{
+		util::Profiler::Probe probe("yul/analysis/callGraph");
+		m_callGraph = CallGraphGenerator::callGraph(_ast);
+	}
+	return *m_callGraph;
+}
+
+map<YulString, SideEffects> const& AnalysisCache::functionSideEffects(Block const& _ast)
+{
+	validateFor(_ast);
+	if (!m_functionSideEffects)
+	{
+		CallGraph const& graph = callGraph(_ast);
+		util::Profiler::Probe probe("yul/analysis/functionSideEffects");
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(m_dialect, graph);
+	}
+	return *m_functionSideEffects;
+}
+
+bool AnalysisCache::containsMSize(Block const& _ast)
+{
+	validateFor(_ast);
+	if (!m_containsMSize)
+	{
+		util::Profiler::Probe probe("yul/analysis/containsMSize");
+		m_containsMSize = MSizeFinder::containsMSize(m_dialect, _ast);
+	}
+	return *m_containsMSize;
+}
+
+void AnalysisCache::invalidate()
+{
+	m_callGraph.reset();
+	m_functionSideEffects.reset();
+	// No optimiser step introduces msize, so its absence stays valid.
+	if (m_containsMSize && *m_containsMSize)
+		m_containsMSize.reset();
+}
+
+map<YulString, SideEffects> AnalysisCache::functionSideEffects(OptimiserStepContext const& _context, Block const& _ast)
+{
+	if (_context.analyses)
+		return _context.analyses->functionSideEffects(_ast);
+	return SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+}
+
+bool AnalysisCache::containsMSize(OptimiserStepContext const& _context, Block const& _ast)
+{
+	if (_context.analyses)
+		return _context.analyses->containsMSize(_ast);
+	return MSizeFinder::containsMSize(_context.dialect, _ast);
+}
+
+void AnalysisCache::validateFor(Block const& _ast)
+{
+	if (m_ast != &_ast)
+	{
+		m_ast = &_ast;
+		m_callGraph.reset();
+		m_functionSideEffects.reset();
+		m_containsMSize.reset();
+	}
+}
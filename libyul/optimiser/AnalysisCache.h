@@ -0,0 +1,79 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of whole-program analyses used by several optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Block;
+struct OptimiserStepContext;
+
+/**
+ * Cache of analyses of the whole AST that are requested by several optimiser steps.
+ *
+ * The results are computed on first request and kept until invalidate() is called.
+ * The optimiser suite does this after every step that does not preserve them, i.e.
+ * that might change function calls, loops or function names (see OptimiserStep).
+ * Since no step introduces calls to msize, the result of containsMSize() is kept
+ * if it is false.
+ *
+ * Steps request analyses through the static functions taking an OptimiserStepContext,
+ * which compute them directly if the context does not provide a cache.
+ */
+class AnalysisCache
+{
+public:
+	explicit AnalysisCache(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	CallGraph const& callGraph(Block const& _ast);
+	/// @returns the side-effects of all user-defined functions in @a _ast.
+	std::map<YulString, SideEffects> const& functionSideEffects(Block const& _ast);
+	/// @returns true if @a _ast contains a call to msize.
+	bool containsMSize(Block const& _ast);
+
+	/// Discards the results that might be changed by modifications of the AST.
+	void invalidate();
+
+	static std::map<YulString, SideEffects> functionSideEffects(OptimiserStepContext const& _context, Block const& _ast);
+	static bool containsMSize(OptimiserStepContext const& _context, Block const& _ast);
+
+private:
+	/// Discards all results if they belong to a different AST than @a _ast.
+	void validateFor(Block const& _ast);
+
+	Dialect const& m_dialect;
+	/// The AST the results belong to.
+	Block const* m_ast = nullptr;
+	std::optional<CallGraph> m_callGraph;
+	std::optional<std::map<YulString, SideEffects>> m_functionSideEffects;
+	std::optional<bool> m_containsMSize;
+};
+
+}
@@ -26,6 +26,8 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <limits>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -194,3 +196,48 @@ void BlockHasher::operator()(Block const& _block)
 	for (auto& externalReference: subBlockHasher.m_externalReferences)
 		(*this)(Identifier{{}, externalReference});
 }
+
+uint64_t ExpressionHasher::run(Expression const& _expression)
+{
+	ExpressionHasher hasher;
+	hasher.visit(_expression);
+	return hasher.m_hash;
+}
+
+void ExpressionHasher::operator()(Literal const& _literal)
+{
+	hash64(compileTimeLiteralHash("Literal"));
+	if (_literal.kind == LiteralKind::Number)
+		// Number literals are compared by value, e.g. ``0x10`` and ``16`` are equal.
+		hash64(static_cast<uint64_t>(valueOfNumberLiteral(_literal) & numeric_limits<uint64_t>::max()));
+	else
+		hash64(_literal.value.hash());
+	hash64(_literal.type.hash());
+	hash8(static_cast<uint8_t>(_literal.kind));
+}
+
+void ExpressionHasher::operator()(Identifier const& _identifier)
+{
+	hash64(compileTimeLiteralHash("Identifier"));
+	hash64(_identifier.name.hash());
+}
+
+uint64_t ExpressionHasher::functionCallHash(YulString _functionName, vector<uint64_t> const& _argumentHashes)
+{
+	ExpressionHasher hasher;
+	hasher.hash64(compileTimeLiteralHash("FunctionCall"));
+	hasher.hash64(_functionName.hash());
+	hasher.hash64(_argumentHashes.size());
+	for (uint64_t argumentHash: _argumentHashes)
+		hasher.hash64(argumentHash);
+	return hasher.m_hash;
+}
+
+void ExpressionHasher::operator()(FunctionCall const& _funCall)
+{
+	vector<uint64_t> argumentHashes;
+	argumentHashes.reserve(_funCall.arguments.size());
+	for (auto const& argument: _funCall.arguments)
+		argumentHashes.emplace_back(run(argument));
+	m_hash = functionCallHash(_funCall.functionName.name, argumentHashes);
+}
@@ -21,6 +21,8 @@
 
 #include <libyul/optimiser/CommonSubexpressionEliminator.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
@@ -39,7 +41,7 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		AnalysisCache::functionSideEffects(_context, _ast)
 	};
 	cse(_ast);
 }
@@ -54,6 +56,9 @@ CommonSubexpressionEliminator::CommonSubexpressionEliminator(
 
 void CommonSubexpressionEliminator::visit(Expression& _e)
 {
+	// Drop the hash of a previous visit, the expression might be replaced this time.
+	m_expressionHashes.erase(&_e);
+
 	bool descend = true;
 	// If this is a function call to a function that requires literal arguments,
 	// do not try to simplify there.
@@ -99,16 +104,90 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 	}
 	else
 	{
-		// TODO this search is rather inefficient.
-		for (auto const& [variable, value]: m_value)
-		{
-			assertThrow(value.value, OptimizerException, "");
-			if (SyntacticallyEqual{}(_e, *value.value))
+		uint64_t hash = hashOf(_e);
+		auto candidates = m_variablesByValueHash.find(hash);
+		if (candidates != m_variablesByValueHash.end())
+			// Among all variables with an equal value, use the first one in the order of m_value,
+			// so that the result does not depend on the order of assignments.
+			for (YulString variable: candidates->second)
 			{
-				assertThrow(inScope(variable), OptimizerException, "");
-				_e = Identifier{locationOf(_e), variable};
-				break;
+				Expression const* value = m_value.at(variable).value;
+				assertThrow(value, OptimizerException, "");
+				if (SyntacticallyEqual{}(_e, *value))
+				{
+					assertThrow(inScope(variable), OptimizerException, "");
+					_e = Identifier{locationOf(_e), variable};
+					return;
+				}
 			}
-		}
+		m_expressionHashes[&_e] = hash;
+	}
+}
+
+void CommonSubexpressionEliminator::operator()(FunctionDefinition& _fun)
+{
+	// DataFlowAnalyzer starts every function without any known values,
+	// so the index starts out empty as well.
+	unordered_map<uint64_t, set<YulString>> variablesByValueHash;
+	map<YulString, uint64_t> valueHashes;
+	swap(m_variablesByValueHash, variablesByValueHash);
+	swap(m_valueHashes, valueHashes);
+	DataFlowAnalyzer::operator()(_fun);
+	swap(m_variablesByValueHash, variablesByValueHash);
+	swap(m_valueHashes, valueHashes);
+}
+
+void CommonSubexpressionEliminator::assignValue(YulString _variable, Expression const* _value)
+{
+	clearValue(_variable);
+	DataFlowAnalyzer::assignValue(_variable, _value);
+	if (!_value)
+		return;
+
+	uint64_t hash = 0;
+	if (auto cached = m_expressionHashes.find(_value); cached != m_expressionHashes.end())
+	{
+		hash = cached->second;
+		m_expressionHashes.erase(cached);
 	}
+	else
+		hash = ExpressionHasher::run(*_value);
+	m_variablesByValueHash[hash].emplace(_variable);
+	m_valueHashes[_variable] = hash;
+}
+
+void CommonSubexpressionEliminator::clearValue(YulString _variable)
+{
+	DataFlowAnalyzer::clearValue(_variable);
+	auto hash = m_valueHashes.find(_variable);
+	if (hash == m_valueHashes.end())
+		return;
+
+	auto bucket = m_variablesByValueHash.find(hash->second);
+	assertThrow(bucket != m_variablesByValueHash.end(), OptimizerException, "");
+	bucket->second.erase(_variable);
+	if (bucket->second.empty())
+		m_variablesByValueHash.erase(bucket);
+	m_valueHashes.erase(hash);
+}
+
+uint64_t CommonSubexpressionEliminator::hashOf(Expression const& _e)
+{
+	FunctionCall const* funCall = get_if<FunctionCall>(&_e);
+	if (!funCall)
+		return ExpressionHasher::run(_e);
+
+	// The arguments have been visited before and their hashes recorded, unless
+	// they were replaced by an identifier or are literal arguments that were not visited.
+	vector<uint64_t> argumentHashes;
+	argumentHashes.reserve(funCall->arguments.size());
+	for (Expression const& argument: funCall->arguments)
+		if (auto cached = m_expressionHashes.find(&argument); cached != m_expressionHashes.end())
+		{
+			argumentHashes.emplace_back(cached->second);
+			m_expressionHashes.erase(cached);
+		}
+		else
+			argumentHashes.emplace_back(ExpressionHasher::run(argument));
+	return ExpressionHasher::functionCallHash(funCall->functionName.name, argumentHashes);
 }
@@ -25,6 +25,10 @@
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/OptimiserStep.h>
 
+#include <map>
+#include <set>
+#include <unordered_map>
+
 namespace solidity::yul
 {
 
@@ -51,7 +55,24 @@ private:
 
 protected:
 	using ASTModifier::visit;
+	using DataFlowAnalyzer::operator();
 	void visit(Expression& _e) override;
+	void operator()(FunctionDefinition&) override;
+
+	void assignValue(YulString _variable, Expression const* _value) override;
+	void clearValue(YulString _variable) override;
+
+private:
+	/// @returns the hash of @a _e, re-using the hashes of its already visited arguments.
+	uint64_t hashOf(Expression const& _e);
+
+	/// Variables with a known value, indexed by the hash of the value.
+	/// Kept in sync with m_value, the variables are ordered like the keys of m_value.
+	std::unordered_map<uint64_t, std::set<YulString>> m_variablesByValueHash;
+	/// The hash of the value of each variable in m_variablesByValueHash.
+	std::map<YulString, uint64_t> m_valueHashes;
+	/// Hashes of visited expressions that have not yet been used by their parent.
+	std::unordered_map<Expression const*, uint64_t> m_expressionHashes;
 };
 
 }
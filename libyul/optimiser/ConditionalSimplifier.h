@@ -54,6 +54,7 @@ class ConditionalSimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ConditionalSimplifier"};
+	static constexpr bool preservesAnalyses{true};
 	static void run(OptimiserStepContext& _context, Block& _ast)
 	{
 		ConditionalSimplifier{_context.dialect}(_ast);
@@ -0,0 +1,174 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that propagates constant function arguments into the called functions.
+ */
+
+#include <libyul/optimiser/ConstantArgumentPropagator.h>
+
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/AST.h>
+#include <libyul/Utilities.h>
+
+#include <optional>
+#include <variant>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// Value of a function parameter in the propagation lattice.
+struct ParameterValue
+{
+	enum class State { Unknown, Constant, Varying };
+	State state = State::Unknown;
+	/// Set if the state is Constant.
+	optional<Literal> literal;
+
+	static ParameterValue varying() { return {State::Varying, nullopt}; }
+
+	/// Lowers this value to the meet of itself and @a _other.
+	/// @returns true if the value changed.
+	bool meet(ParameterValue const& _other)
+	{
+		if (_other.state == State::Unknown || state == State::Varying)
+			return false;
+		if (state == State::Unknown)
+		{
+			*this = _other;
+			return true;
+		}
+		if (
+			_other.state == State::Constant &&
+			valueOfLiteral(*literal) == valueOfLiteral(*_other.literal)
+		)
+			return false;
+		*this = varying();
+		return true;
+	}
+};
+
+/// Collects all function definitions and calls to them.
+class FunctionCallCollector: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		m_functions[_function.name] = &_function;
+		ASTWalker::operator()(_function);
+	}
+	void operator()(FunctionCall const& _call) override
+	{
+		m_calls.emplace_back(&_call);
+		ASTWalker::operator()(_call);
+	}
+
+	map<YulString, FunctionDefinition const*> const& functions() const { return m_functions; }
+	vector<FunctionCall const*> const& calls() const { return m_calls; }
+
+private:
+	map<YulString, FunctionDefinition const*> m_functions;
+	vector<FunctionCall const*> m_calls;
+};
+
+}
+
+void ConstantArgumentPropagator::run(OptimiserStepContext&, Block& _ast)
+{
+	FunctionCallCollector collector;
+	collector(_ast);
+	Assignments assignments;
+	assignments(_ast);
+	SSAValueTracker ssaValues;
+	ssaValues(_ast);
+
+	map<YulString, vector<ParameterValue>> values;
+	map<YulString, pair<YulString, size_t>> parameters;
+	for (auto const& [functionName, function]: collector.functions())
+	{
+		values[functionName].resize(function->parameters.size());
+		for (size_t i = 0; i < function->parameters.size(); ++i)
+			parameters[function->parameters[i].name] = {functionName, i};
+	}
+
+	auto evaluate = [&](Expression const& _argument) -> ParameterValue
+	{
+		Literal const* literal = get_if<Literal>(&_argument);
+		if (Identifier const* identifier = get_if<Identifier>(&_argument))
+		{
+			if (assignments.names().count(identifier->name))
+				return ParameterValue::varying();
+			if (parameters.count(identifier->name))
+			{
+				auto const& [functionName, index] = parameters.at(identifier->name);
+				return values.at(functionName).at(index);
+			}
+			if (ssaValues.values().count(identifier->name))
+				literal = get_if<Literal>(ssaValues.value(identifier->name));
+		}
+		if (!literal || (literal->kind == LiteralKind::String && literal->value.str().size() > 32))
+			return ParameterValue::varying();
+		return {ParameterValue::State::Constant, *literal};
+	};
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (FunctionCall const* call: collector.calls())
+			if (values.count(call->functionName.name))
+			{
+				vector<ParameterValue>& calleeValues = values[call->functionName.name];
+				yulAssert(calleeValues.size() == call->arguments.size(), "");
+				for (size_t i = 0; i < call->arguments.size(); ++i)
+					if (calleeValues[i].meet(evaluate(call->arguments[i])))
+						changed = true;
+			}
+	}
+
+	map<YulString, Literal> constantParameters;
+	for (auto const& [functionName, function]: collector.functions())
+		for (size_t i = 0; i < function->parameters.size(); ++i)
+		{
+			TypedName const& parameter = function->parameters[i];
+			ParameterValue const& value = values.at(functionName)[i];
+			if (value.state == ParameterValue::State::Constant && !assignments.names().count(parameter.name))
+				constantParameters[parameter.name] = Literal{{}, value.literal->kind, value.literal->value, parameter.type};
+		}
+
+	if (!constantParameters.empty())
+		ConstantArgumentPropagator{move(constantParameters)}(_ast);
+}
+
+void ConstantArgumentPropagator::visit(Expression& _expression)
+{
+	if (Identifier const* identifier = get_if<Identifier>(&_expression))
+		if (m_constantParameters.count(identifier->name))
+		{
+			Literal const& value = m_constantParameters.at(identifier->name);
+			_expression = Literal{identifier->location, value.kind, value.value, value.type};
+			return;
+		}
+	ASTModifier::visit(_expression);
+}
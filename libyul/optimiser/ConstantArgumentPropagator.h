@@ -0,0 +1,87 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimiser component that propagates constant function arguments into the called functions.
+ */
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/AST.h>
+#include <libyul/YulString.h>
+
+#include <map>
+
+namespace solidity::yul
+{
+
+struct OptimiserStepContext;
+
+/**
+ * Optimiser component that determines, for the whole program, the function parameters that
+ * receive the same constant value at every call site and replaces all references to such a
+ * parameter inside the function body by that value.
+ *
+ * The value of each parameter is an element of the lattice "no call seen yet", "constant"
+ * and "not constant". An argument is constant if it is a literal, a variable whose
+ * (only) value is a literal or a parameter of the calling function that is itself constant.
+ * Starting from "no call seen yet" for all parameters, the values are lowered until a
+ * fixpoint is reached, so constants also propagate through chains of (mutually recursive)
+ * functions. Parameters of functions that are never called are left untouched.
+ *
+ * Example:
+ *
+ *  function f(a, b) -> r { r := add(a, g(b)) }
+ *  function g(c) -> s { s := mul(c, 2) }
+ *  sstore(0, f(calldataload(0), 7))
+ *  sstore(1, f(calldataload(1), 7))
+ *
+ * is transformed to
+ *
+ *  function f(a, b) -> r { r := add(a, g(7)) }
+ *  function g(c) -> s { s := mul(7, 2) }
+ *  ...
+ *
+ * The calls themselves are not changed, the now unused parameters can be removed by the
+ * UnusedFunctionParameterPruner and the constants can be folded by the ExpressionSimplifier.
+ * Parameters that are assigned to are never replaced.
+ *
+ * The step is not part of the default sequence, since the FullInliner already handles most
+ * functions called with constant arguments (see the documentation of the optimiser steps).
+ *
+ * Prerequisite: Disambiguator
+ */
+class ConstantArgumentPropagator: public ASTModifier
+{
+public:
+	static constexpr char const* name{"ConstantArgumentPropagator"};
+	static void run(OptimiserStepContext&, Block& _ast);
+
+	using ASTModifier::operator();
+	void visit(Expression& _expression) override;
+
+private:
+	explicit ConstantArgumentPropagator(std::map<YulString, Literal> _constantParameters):
+		m_constantParameters(std::move(_constantParameters))
+	{}
+
+	/// Maps the names of the parameters to be replaced to their values.
+	std::map<YulString, Literal> m_constantParameters;
+};
+
+}
@@ -339,7 +339,7 @@ void DataFlowAnalyzer::clearValues(set<YulString> _variables)
 
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables)
-		m_value.erase(name);
+		clearValue(name);
 	for (auto const& name: _variables)
 		m_references.eraseKey(name);
 }
@@ -349,6 +349,11 @@ void DataFlowAnalyzer::assignValue(YulString _variable, Expression const* _value
 	m_value[_variable] = {_value, m_loopDepth};
 }
 
+void DataFlowAnalyzer::clearValue(YulString _variable)
+{
+	m_value.erase(_variable);
+}
+
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
 	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
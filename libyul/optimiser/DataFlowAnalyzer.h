@@ -112,7 +112,12 @@ protected:
 	/// for example at points where control flow is merged.
 	void clearValues(std::set<YulString> _names);
 
-	void assignValue(YulString _variable, Expression const* _value);
+	/// Records @a _value as the current value of @a _variable.
+	virtual void assignValue(YulString _variable, Expression const* _value);
+
+	/// Forgets the current value of @a _variable, if any.
+	/// Called by clearValues for every affected variable.
+	virtual void clearValue(YulString _variable);
 
 	/// Clears knowledge about storage or memory if they may be modified inside the block.
 	void clearKnowledgeIfInvalidated(Block const& _block);
@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/ExecutionProfile.h>
+
+#include <libyul/AST.h>
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+void ExecutionProfile::recordCalls(langutil::SourceLocation const& _location, size_t _calls)
+{
+	size_t& calls = m_calls[{_location.start, _location.end}];
+	calls += _calls;
+	m_maxCalls = max(m_maxCalls, calls);
+}
+
+optional<size_t> ExecutionProfile::calls(FunctionDefinition const& _function) const
+{
+	auto it = m_calls.find({_function.location.start, _function.location.end});
+	if (it == m_calls.end())
+		return nullopt;
+	return it->second;
+}
+
+bool ExecutionProfile::cold(FunctionDefinition const& _function) const
+{
+	return calls(_function) == size_t(0);
+}
+
+bool ExecutionProfile::hot(FunctionDefinition const& _function) const
+{
+	optional<size_t> count = calls(_function);
+	return count && *count > 0 && *count * 16 >= m_maxCalls;
+}
+
+Json::Value ExecutionProfile::toJson() const
+{
+	Json::Value result{Json::objectValue};
+	for (auto const& [position, calls]: m_calls)
+		result[to_string(position.first) + ":" + to_string(position.second - position.first)] = Json::UInt64(calls);
+	return result;
+}
+
+optional<ExecutionProfile> ExecutionProfile::fromJson(Json::Value const& _json)
+{
+	if (!_json.isObject())
+		return nullopt;
+
+	ExecutionProfile profile;
+	for (string const& key: _json.getMemberNames())
+	{
+		vector<string> parts;
+		boost::split(parts, key, boost::is_any_of(":"));
+		if (
+			parts.size() != 2 ||
+			parts[0].empty() || !boost::all(parts[0], boost::is_digit()) ||
+			parts[1].empty() || !boost::all(parts[1], boost::is_digit()) ||
+			!_json[key].isUInt64()
+		)
+			return nullopt;
+		try
+		{
+			int start = stoi(parts[0]);
+			int length = stoi(parts[1]);
+			profile.recordCalls(
+				langutil::SourceLocation{start, start + length, {}},
+				static_cast<size_t>(_json[key].asUInt64())
+			);
+		}
+		catch (out_of_range const&)
+		{
+			return nullopt;
+		}
+	}
+	return profile;
+}
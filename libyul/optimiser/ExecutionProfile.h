@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Execution counts of Yul functions, used to guide the optimiser.
+ */
+
+#pragma once
+
+#include <liblangutil/SourceLocation.h>
+
+#include <json/json.h>
+
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace solidity::yul
+{
+
+struct FunctionDefinition;
+
+/**
+ * Number of calls of each function observed while executing the code, for example
+ * in the Yul interpreter.
+ *
+ * Functions are identified by the position of their definition in the source, since
+ * the optimiser renames functions, but keeps their source locations. The name of the
+ * source is not recorded, so a profile must only be applied to the single source it was
+ * recorded for.
+ * A function that is not contained in the profile is neither hot nor cold.
+ */
+class ExecutionProfile
+{
+public:
+	/// Adds @a _calls to the number of calls of the function defined at @a _location.
+	/// Use zero to record functions that were defined but never called.
+	void recordCalls(langutil::SourceLocation const& _location, size_t _calls = 1);
+
+	/// @returns the number of recorded calls of @a _function, if it is contained in the profile.
+	std::optional<size_t> calls(FunctionDefinition const& _function) const;
+	/// @returns true if @a _function was never called.
+	bool cold(FunctionDefinition const& _function) const;
+	/// @returns true if @a _function was called at least a sixteenth as often as the
+	/// most frequently called function.
+	bool hot(FunctionDefinition const& _function) const;
+
+	bool empty() const { return m_calls.empty(); }
+
+	/// @returns the profile as JSON object that maps "<start>:<length>" of each
+	/// function definition to its number of calls.
+	Json::Value toJson() const;
+	/// @returns the profile contained in @a _json or nullopt if it is not in the format
+	/// produced by toJson().
+	static std::optional<ExecutionProfile> fromJson(Json::Value const& _json);
+
+private:
+	/// Number of calls by start and end position of the function definition.
+	std::map<std::pair<int, int>, size_t> m_calls;
+	size_t m_maxCalls = 0;
+};
+
+}
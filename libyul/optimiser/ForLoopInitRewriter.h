@@ -32,6 +32,7 @@ class ForLoopInitRewriter: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ForLoopInitRewriter"};
+	static constexpr bool preservesAnalyses{true};
 	static void run(OptimiserStepContext&, Block& _ast)
 	{
 		ForLoopInitRewriter{}(_ast);
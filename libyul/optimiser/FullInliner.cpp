@@ -23,6 +23,7 @@
 
 #include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/ExecutionProfile.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Metrics.h>
@@ -42,13 +43,18 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{_ast, _context.dispenser, _context.dialect, _context.profile};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
-	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect)
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	ExecutionProfile const* _profile
+):
+	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect), m_profile(_profile)
 {
 	// Determine constants
 	SSAValueTracker tracker;
@@ -186,6 +192,17 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	// Use the execution counts of the calling function, if available: Never executed code
+	// is optimised for size, frequently executed code for gas.
+	size_t sizeFactor = 1;
+	if (FunctionDefinition const* caller = m_profile ? function(_callSite) : nullptr)
+	{
+		if (m_profile->cold(*caller))
+			return false;
+		if (m_profile->hot(*caller))
+			sizeFactor = 2;
+	}
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -198,7 +215,7 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 			break;
 		}
 
-	return (size < 6 || (constantArg && size < 12));
+	return (size < 6 * sizeFactor || (constantArg && size < 12 * sizeFactor));
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
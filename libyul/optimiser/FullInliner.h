@@ -38,6 +38,7 @@ namespace solidity::yul
 {
 
 class NameCollector;
+class ExecutionProfile;
 
 
 /**
@@ -93,7 +94,12 @@ public:
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		ExecutionProfile const* _profile = nullptr
+	);
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
@@ -118,6 +124,10 @@ private:
 	std::map<YulString, size_t> m_functionSizes;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	/// Execution counts of the functions. Calls inside functions that were never executed
+	/// are only inlined if that does not increase the code size, calls inside frequently
+	/// executed functions are inlined more aggressively.
+	ExecutionProfile const* m_profile = nullptr;
 };
 
 /**
@@ -0,0 +1,116 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of optimising Yul objects.
+ */
+
+#include <libyul/optimiser/OptimisedObjectCache.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/AST.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+
+#include <libsolutil/Keccak256.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+using namespace solidity::langutil;
+
+namespace
+{
+
+/// Copier that records all source locations it encounters.
+class LocationCollector: public ASTCopier
+{
+public:
+	vector<SourceLocation> locations;
+
+protected:
+	SourceLocation translateLocation(SourceLocation const& _location) override
+	{
+		locations.push_back(_location);
+		return _location;
+	}
+};
+
+/// Copier that replaces source locations according to a map and drops all other locations.
+class LocationTranslator: public ASTCopier
+{
+public:
+	explicit LocationTranslator(map<SourceLocation, SourceLocation> _translation):
+		m_translation(move(_translation))
+	{}
+
+protected:
+	SourceLocation translateLocation(SourceLocation const& _location) override
+	{
+		auto it = m_translation.find(_location);
+		return it == m_translation.end() ? SourceLocation{} : it->second;
+	}
+
+private:
+	map<SourceLocation, SourceLocation> m_translation;
+};
+
+}
+
+h256 OptimisedObjectCache::key(Object const& _object, Dialect const& _dialect, string const& _settings)
+{
+	return keccak256(_settings + ":" + _object.toString(&_dialect));
+}
+
+vector<SourceLocation> OptimisedObjectCache::sourceLocations(Block const& _code)
+{
+	LocationCollector collector;
+	collector.translate(_code);
+	return move(collector.locations);
+}
+
+optional<Block> OptimisedObjectCache::optimisedCode(h256 const& _key, Block const& _unoptimisedCode) const
+{
+	auto it = m_code.find(_key);
+	if (it == m_code.end())
+	{
+		m_misses++;
+		return nullopt;
+	}
+	m_hits++;
+
+	Entry const& entry = it->second;
+	vector<SourceLocation> locations = sourceLocations(_unoptimisedCode);
+	yulAssert(locations.size() == entry.unoptimisedLocations.size(), "Unoptimised code does not match the cache entry.");
+	map<SourceLocation, SourceLocation> translation;
+	for (size_t i = 0; i < locations.size(); ++i)
+		translation.emplace(entry.unoptimisedLocations[i], move(locations[i]));
+	return LocationTranslator{move(translation)}.translate(*entry.optimisedCode);
+}
+
+void OptimisedObjectCache::store(
+	h256 const& _key,
+	vector<SourceLocation> _unoptimisedLocations,
+	Block const& _optimisedCode
+)
+{
+	m_code[_key] = Entry{
+		move(_unoptimisedLocations),
+		make_shared<Block const>(ASTCopier{}.translate(_optimisedCode))
+	};
+}
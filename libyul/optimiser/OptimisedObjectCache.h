@@ -0,0 +1,100 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of optimising Yul objects.
+ */
+#pragma once
+
+#include <libyul/ASTForward.h>
+
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Object;
+
+/**
+ * Stores the optimised code of Yul objects, keyed by the hash of the unoptimised object
+ * (including its already optimised sub-objects) together with all settings that influence
+ * the optimiser.
+ *
+ * The Yul code generated for a contract contains the complete objects of all contracts it
+ * creates, so the same object is optimised once on its own and once inside every creating
+ * contract. Sharing one cache between the optimiser runs of a compilation avoids this.
+ *
+ * Source locations are not part of the key: the same object appears at different positions
+ * (and with different indentation) in the IR of every contract. Each entry therefore also
+ * records the source locations of the unoptimised code in the order ASTCopier visits them.
+ * On a hit, the locations of the unoptimised code of the requesting object are collected in
+ * the same order, which maps every recorded location to its counterpart, and the cached code
+ * is returned with its locations rewritten accordingly. Locations in the optimised code that
+ * do not occur in the unoptimised code are replaced by empty locations.
+ *
+ * The cached code references YulStrings, so the cache must not outlive the YulStringRepository
+ * it was filled with, i.e. it should be used for a single compilation only.
+ */
+class OptimisedObjectCache: boost::noncopyable
+{
+public:
+	/// @returns the key under which the result of optimising @a _object with the
+	/// settings described by @a _settings is stored.
+	static util::h256 key(Object const& _object, Dialect const& _dialect, std::string const& _settings);
+
+	/// @returns the source locations of @a _code in the order in which they are recorded by the cache.
+	static std::vector<langutil::SourceLocation> sourceLocations(Block const& _code);
+
+	/// @returns a copy of the optimised code stored under @a _key, with the source locations
+	/// translated to those of @a _unoptimisedCode, or nullopt if there is none.
+	/// @a _unoptimisedCode has to be the code of the object @a _key was computed from.
+	std::optional<Block> optimisedCode(util::h256 const& _key, Block const& _unoptimisedCode) const;
+	/// Stores a copy of @a _optimisedCode under @a _key. @a _unoptimisedLocations are the
+	/// locations of the code before optimisation, as returned by sourceLocations().
+	void store(
+		util::h256 const& _key,
+		std::vector<langutil::SourceLocation> _unoptimisedLocations,
+		Block const& _optimisedCode
+	);
+
+	size_t hits() const { return m_hits; }
+	size_t misses() const { return m_misses; }
+
+private:
+	struct Entry
+	{
+		std::vector<langutil::SourceLocation> unoptimisedLocations;
+		std::shared_ptr<Block const> optimisedCode;
+	};
+
+	std::map<util::h256, Entry> m_code;
+	mutable size_t m_hits = 0;
+	mutable size_t m_misses = 0;
+};
+
+}
@@ -31,12 +31,18 @@ struct Dialect;
 struct Block;
 class YulString;
 class NameDispenser;
+class AnalysisCache;
+class ExecutionProfile;
 
 struct OptimiserStepContext
 {
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
+	/// Cache of analyses of the AST the steps are run on, if provided by the caller.
+	AnalysisCache* analyses = nullptr;
+	/// Recorded execution counts of the functions, if provided by the caller.
+	ExecutionProfile const* profile = nullptr;
 };
 
 
@@ -54,6 +60,10 @@ struct OptimiserStep
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
 	virtual std::optional<std::string> invalidInCurrentEnvironment() const = 0;
+	/// @returns true if the step does not change function calls, loops or function names
+	/// and thus keeps the results in the AnalysisCache valid. Steps declare this by
+	/// defining ``static constexpr bool preservesAnalyses{true};``.
+	virtual bool preservesAnalyses() const = 0;
 	std::string name;
 };
 
@@ -72,6 +82,17 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct HasPreservesAnalysesMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::preservesAnalyses, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
 	void run(OptimiserStepContext& _context, Block& _ast) const override
@@ -85,6 +106,13 @@ public:
 		else
 			return std::nullopt;
 	}
+	bool preservesAnalyses() const override
+	{
+		if constexpr (HasPreservesAnalysesMember<Step>::value)
+			return Step::preservesAnalyses;
+		else
+			return false;
+	}
 };
 
 
@@ -29,6 +29,7 @@
 #include <libyul/optimiser/ControlFlowSimplifier.h>
 #include <libyul/optimiser/ConditionalSimplifier.h>
 #include <libyul/optimiser/ConditionalUnsimplifier.h>
+#include <libyul/optimiser/ConstantArgumentPropagator.h>
 #include <libyul/optimiser/DeadCodeEliminator.h>
 #include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/FunctionHoister.h>
@@ -71,11 +72,14 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Profiler.h>
 
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm_ext/erase.hpp>
 #include <libyul/CompilabilityChecker.h>
 
+#include <chrono>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -86,7 +90,8 @@ void OptimiserSuite::run(
 	Object& _object,
 	bool _optimizeStackAllocation,
 	string const& _optimisationSequence,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	ExecutionProfile const* _profile
 )
 {
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
@@ -100,6 +105,7 @@ void OptimiserSuite::run(
 	Block& ast = *_object.code;
 
 	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
+	suite.m_context.profile = _profile;
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -179,6 +185,7 @@ map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 			CommonSubexpressionEliminator,
 			ConditionalSimplifier,
 			ConditionalUnsimplifier,
+			ConstantArgumentPropagator,
 			ControlFlowSimplifier,
 			DeadCodeEliminator,
 			EquivalentFunctionCombiner,
@@ -218,6 +225,7 @@ map<string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 		{CommonSubexpressionEliminator::name, 'c'},
 		{ConditionalSimplifier::name,         'C'},
 		{ConditionalUnsimplifier::name,       'U'},
+		{ConstantArgumentPropagator::name,    'A'},
 		{ControlFlowSimplifier::name,         'n'},
 		{DeadCodeEliminator::name,            'D'},
 		{EquivalentFunctionCombiner::name,    'v'},
@@ -341,11 +349,29 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
+	m_analyses.invalidate();
+	m_context.analyses = &m_analyses;
+	ScopeGuard resetAnalyses{[&] { m_context.analyses = nullptr; }};
 	for (string const& step: _steps)
 	{
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		if (util::Profiler::enabled())
+		{
+			int64_t sizeBefore = static_cast<int64_t>(CodeSize::codeSizeIncludingFunctions(_ast));
+			auto start = chrono::steady_clock::now();
+			allSteps().at(step)->run(m_context, _ast);
+			auto time = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+			util::Profiler::record(
+				"yul/" + step,
+				time,
+				static_cast<int64_t>(CodeSize::codeSizeIncludingFunctions(_ast)) - sizeBefore
+			);
+		}
+		else
+			allSteps().at(step)->run(m_context, _ast);
+		if (!allSteps().at(step)->preservesAnalyses())
+			m_analyses.invalidate();
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
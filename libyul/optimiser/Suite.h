@@ -23,6 +23,7 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/YulString.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
@@ -64,7 +65,8 @@ public:
 		Object& _object,
 		bool _optimizeStackAllocation,
 		std::string const& _optimisationSequence,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		ExecutionProfile const* _profile = nullptr
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -91,11 +93,15 @@ private:
 		Block& _ast
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
+		m_analyses{_dialect},
 		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers},
 		m_debug(_debug)
 	{}
 
 	NameDispenser m_dispenser;
+	/// Analyses shared between the steps of a sequence. Only provided to the steps
+	/// while running a sequence, since the AST may be modified in between.
+	AnalysisCache m_analyses;
 	OptimiserStepContext m_context;
 	Debug m_debug;
 };
@@ -20,6 +20,7 @@
 
 #include <libyul/optimiser/UnusedPruner.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Semantics.h>
@@ -33,6 +34,30 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/// Removes empty blocks, visiting inner blocks before outer blocks, so that
+/// blocks which only contain empty blocks are removed as well.
+struct EmptyBlockRemover: ASTModifier
+{
+	using ASTModifier::operator();
+	void operator()(Block& _block) override
+	{
+		ASTModifier::operator()(_block);
+		removeEmptyBlocks(_block);
+	}
+};
+
+}
+
+void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
+{
+	map<YulString, SideEffects> functionSideEffects = AnalysisCache::functionSideEffects(_context, _ast);
+	bool allowMSizeOptimization = !AnalysisCache::containsMSize(_context, _ast);
+	runUntilStabilised(_context.dialect, _ast, allowMSizeOptimization, &functionSideEffects, _context.reservedIdentifiers);
+}
+
 UnusedPruner::UnusedPruner(
 	Dialect const& _dialect,
 	Block& _ast,
@@ -66,63 +91,114 @@ UnusedPruner::UnusedPruner(
 void UnusedPruner::operator()(Block& _block)
 {
 	for (auto&& statement: _block.statements)
-		if (holds_alternative<FunctionDefinition>(statement))
+		pruneStatement(statement);
+
+	removeEmptyBlocks(_block);
+
+	// The statements of this block are not moved anymore during this run, so they
+	// can be revisited in case their declarations become unused later on.
+	for (auto&& statement: _block.statements)
+		if (auto const* funDef = get_if<FunctionDefinition>(&statement))
+			m_declarationStatements[funDef->name] = &statement;
+		else if (auto const* varDecl = get_if<VariableDeclaration>(&statement))
+			for (auto const& var: varDecl->variables)
+				m_declarationStatements[var.name] = &statement;
+
+	ASTModifier::operator()(_block);
+}
+
+bool UnusedPruner::pruneStatement(Statement& _statement)
+{
+	if (holds_alternative<FunctionDefinition>(_statement))
+	{
+		FunctionDefinition& funDef = std::get<FunctionDefinition>(_statement);
+		if (!used(funDef.name))
 		{
-			FunctionDefinition& funDef = std::get<FunctionDefinition>(statement);
-			if (!used(funDef.name))
-			{
-				subtractReferences(ReferencesCounter::countReferences(funDef.body));
-				statement = Block{std::move(funDef.location), {}};
-			}
+			// The body is removed, so forget about the declarations inside it.
+			for (YulString name: NameCollector{funDef.body}.names())
+				m_declarationStatements.erase(name);
+			m_declarationStatements.erase(funDef.name);
+			subtractReferences(ReferencesCounter::countReferences(funDef.body));
+			_statement = Block{std::move(funDef.location), {}};
+			return true;
 		}
-		else if (holds_alternative<VariableDeclaration>(statement))
+	}
+	else if (holds_alternative<VariableDeclaration>(_statement))
+	{
+		VariableDeclaration& varDecl = std::get<VariableDeclaration>(_statement);
+		// Multi-variable declarations are special. We can only remove it
+		// if all variables are unused and the right-hand-side is either
+		// movable or it returns a single value. In the latter case, we
+		// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
+		// `drop(f())`).
+		if (std::none_of(
+			varDecl.variables.begin(),
+			varDecl.variables.end(),
+			[&](TypedName const& _typedName) { return used(_typedName.name); }
+		))
 		{
-			VariableDeclaration& varDecl = std::get<VariableDeclaration>(statement);
-			// Multi-variable declarations are special. We can only remove it
-			// if all variables are unused and the right-hand-side is either
-			// movable or it returns a single value. In the latter case, we
-			// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
-			// `drop(f())`).
-			if (std::none_of(
-				varDecl.variables.begin(),
-				varDecl.variables.end(),
-				[&](TypedName const& _typedName) { return used(_typedName.name); }
-			))
+			if (!varDecl.value)
 			{
-				if (!varDecl.value)
-					statement = Block{std::move(varDecl.location), {}};
-				else if (
-					SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
-					canBeRemoved(m_allowMSizeOptimization)
-				)
-				{
-					subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
-					statement = Block{std::move(varDecl.location), {}};
-				}
-				else if (varDecl.variables.size() == 1 && m_dialect.discardFunction(varDecl.variables.front().type))
-					statement = ExpressionStatement{varDecl.location, FunctionCall{
-						varDecl.location,
-						{varDecl.location, m_dialect.discardFunction(varDecl.variables.front().type)->name},
-						{*std::move(varDecl.value)}
-					}};
+				_statement = Block{std::move(varDecl.location), {}};
+				return true;
 			}
-		}
-		else if (holds_alternative<ExpressionStatement>(statement))
-		{
-			ExpressionStatement& exprStmt = std::get<ExpressionStatement>(statement);
-			if (
-				SideEffectsCollector(m_dialect, exprStmt.expression, m_functionSideEffects).
+			else if (
+				SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
 				canBeRemoved(m_allowMSizeOptimization)
 			)
 			{
-				subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
-				statement = Block{std::move(exprStmt.location), {}};
+				subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
+				_statement = Block{std::move(varDecl.location), {}};
+				return true;
+			}
+			else if (varDecl.variables.size() == 1 && m_dialect.discardFunction(varDecl.variables.front().type))
+			{
+				_statement = ExpressionStatement{varDecl.location, FunctionCall{
+					varDecl.location,
+					{varDecl.location, m_dialect.discardFunction(varDecl.variables.front().type)->name},
+					{*std::move(varDecl.value)}
+				}};
+				return true;
 			}
 		}
+	}
+	else if (holds_alternative<ExpressionStatement>(_statement))
+	{
+		ExpressionStatement& exprStmt = std::get<ExpressionStatement>(_statement);
+		if (
+			SideEffectsCollector(m_dialect, exprStmt.expression, m_functionSideEffects).
+			canBeRemoved(m_allowMSizeOptimization)
+		)
+		{
+			subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
+			_statement = Block{std::move(exprStmt.location), {}};
+			return true;
+		}
+	}
+	return false;
+}
 
-	removeEmptyBlocks(_block);
+template <typename ASTNode>
+void UnusedPruner::runWithWorklist(ASTNode& _node)
+{
+	(*this)(_node);
 
-	ASTModifier::operator()(_block);
+	// Removing a declaration can make further declarations unused, which
+	// are then added to the worklist in turn.
+	while (!m_unusedNames.empty())
+	{
+		YulString name = m_unusedNames.back();
+		m_unusedNames.pop_back();
+		if (used(name))
+			continue;
+		auto it = m_declarationStatements.find(name);
+		if (it != m_declarationStatements.end())
+			pruneStatement(*it->second);
+	}
+
+	// Code removed after its block has been visited leaves empty blocks behind.
+	if (m_referencesRemoved)
+		EmptyBlockRemover{}(_node);
 }
 
 void UnusedPruner::runUntilStabilised(
@@ -133,15 +209,10 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
-	while (true)
-	{
-		UnusedPruner pruner(
-			_dialect, _ast, _allowMSizeOptimization, _functionSideEffects,
-							_externallyUsedFunctions);
-		pruner(_ast);
-		if (!pruner.shouldRunAgain())
-			return;
-	}
+	UnusedPruner pruner(
+		_dialect, _ast, _allowMSizeOptimization, _functionSideEffects,
+		_externallyUsedFunctions);
+	pruner.runWithWorklist(_ast);
 }
 
 void UnusedPruner::runUntilStabilisedOnFullAST(
@@ -163,13 +234,8 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
-	while (true)
-	{
-		UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
-		pruner(_function);
-		if (!pruner.shouldRunAgain())
-			return;
-	}
+	UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
+	pruner.runWithWorklist(_function);
 }
 
 bool UnusedPruner::used(YulString _name) const
@@ -181,9 +247,12 @@ void UnusedPruner::subtractReferences(map<YulString, size_t> const& _subtrahend)
 {
 	for (auto const& ref: _subtrahend)
 	{
-		assertThrow(m_references.count(ref.first), OptimizerException, "");
-		assertThrow(m_references.at(ref.first) >= ref.second, OptimizerException, "");
-		m_references[ref.first] -= ref.second;
-		m_shouldRunAgain = true;
+		auto it = m_references.find(ref.first);
+		assertThrow(it != m_references.end(), OptimizerException, "");
+		assertThrow(it->second >= ref.second, OptimizerException, "");
+		it->second -= ref.second;
+		if (it->second == 0)
+			m_unusedNames.emplace_back(ref.first);
+		m_referencesRemoved = true;
 	}
 }
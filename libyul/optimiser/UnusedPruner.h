@@ -27,6 +27,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -44,23 +45,22 @@ struct SideEffects;
  *
  * Note that this does not remove circular references.
  *
+ * Reference counts are kept up to date while code is removed. Declarations that
+ * become unused after they have been visited are collected in a worklist and removed
+ * afterwards, so a single traversal suffices.
+ *
  * Prerequisite: Disambiguator
  */
 class UnusedPruner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"UnusedPruner"};
-	static void run(OptimiserStepContext& _context, Block& _ast) {
-		UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
-	}
+	static void run(OptimiserStepContext& _context, Block& _ast);
 
 
 	using ASTModifier::operator();
 	void operator()(Block& _block) override;
 
-	// @returns true iff the code changed in the previous run.
-	bool shouldRunAgain() const { return m_shouldRunAgain; }
-
 	// Run the pruner until the code does not change anymore.
 	static void runUntilStabilised(
 		Dialect const& _dialect,
@@ -116,14 +116,28 @@ private:
 		std::set<YulString> const& _externallyUsedFunctions = {}
 	);
 
+	/// Runs the pruner on @a _node and afterwards removes the declarations that
+	/// became unused only after they had been visited.
+	template <typename ASTNode>
+	void runWithWorklist(ASTNode& _node);
+
+	/// Removes or replaces @a _statement if it is unused or has no effect.
+	/// @returns true if the statement was changed.
+	bool pruneStatement(Statement& _statement);
+
 	bool used(YulString _name) const;
 	void subtractReferences(std::map<YulString, size_t> const& _subtrahend);
 
 	Dialect const& m_dialect;
 	bool m_allowMSizeOptimization = false;
 	std::map<YulString, SideEffects> const* m_functionSideEffects = nullptr;
-	bool m_shouldRunAgain = false;
+	/// True if any references were removed, which might leave empty blocks behind.
+	bool m_referencesRemoved = false;
 	std::map<YulString, size_t> m_references;
+	/// Visited declarations that have not been removed, by declared name.
+	std::map<YulString, Statement*> m_declarationStatements;
+	/// Names whose reference count dropped to zero.
+	std::vector<YulString> m_unusedNames;
 };
 
 }
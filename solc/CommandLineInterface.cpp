@@ -34,10 +34,12 @@
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/GasEstimator.h>
+#include <libsolidity/interface/IRCache.h>
 #include <libsolidity/interface/DebugSettings.h>
 #include <libsolidity/interface/StorageLayout.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/optimiser/ExecutionProfile.h>
 #include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Instruction.h>
@@ -53,6 +55,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Profiler.h>
 
 #include <algorithm>
 #include <memory>
@@ -144,6 +147,7 @@ static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
 static string const g_strIR = "ir";
 static string const g_strIROptimized = "ir-optimized";
+static string const g_strIRCache = "ir-cache";
 static string const g_strIPFS = "ipfs";
 static string const g_strLicense = "license";
 static string const g_strLibraries = "libraries";
@@ -163,8 +167,11 @@ static string const g_strOptimize = "optimize";
 static string const g_strOptimizeRuns = "optimize-runs";
 static string const g_strOptimizeYul = "optimize-yul";
 static string const g_strYulOptimizations = "yul-optimizations";
+static string const g_strYulExecutionProfile = "yul-execution-profile";
 static string const g_strOutputDir = "output-dir";
 static string const g_strOverwrite = "overwrite";
+static string const g_strParallelAsmOptimizer = "parallel-asm-optimizer";
+static string const g_strProfile = "profile";
 static string const g_strRevertStrings = "revert-strings";
 static string const g_strStorageLayout = "storage-layout";
 static string const g_strStopAfter = "stop-after";
@@ -215,6 +222,7 @@ static string const g_argInputFile = g_strInputFile;
 static string const g_argYul = g_strYul;
 static string const g_argIR = g_strIR;
 static string const g_argIROptimized = g_strIROptimized;
+static string const g_argIRCache = g_strIRCache;
 static string const g_argEwasm = g_strEwasm;
 static string const g_argExperimentalViaIR = g_strExperimentalViaIR;
 static string const g_argLibraries = g_strLibraries;
@@ -231,6 +239,7 @@ static string const g_argOpcodes = g_strOpcodes;
 static string const g_argOptimize = g_strOptimize;
 static string const g_argOptimizeRuns = g_strOptimizeRuns;
 static string const g_argOutputDir = g_strOutputDir;
+static string const g_argProfile = g_strProfile;
 static string const g_argSignatureHashes = g_strSignatureHashes;
 static string const g_argStandardJSON = g_strStandardJSON;
 static string const g_argStorageLayout = g_strStorageLayout;
@@ -976,6 +985,10 @@ General Information)").c_str(),
 			g_argGas.c_str(),
 			"Print an estimate of the maximal gas usage for each function."
 		)
+		(
+			g_argProfile.c_str(),
+			"Print the time spent in the individual compiler phases and optimiser steps to stderr."
+		)
 		(
 			g_argCombinedJson.c_str(),
 			po::value<string>()->value_name(boost::join(g_combinedJsonArgs, ",")),
@@ -1023,6 +1036,24 @@ General Information)").c_str(),
 			po::value<string>()->value_name("steps"),
 			"Forces yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strYulExecutionProfile.c_str(),
+			po::value<string>()->value_name("file"),
+			"Use the number of calls of each function recorded in the given file (e.g. by yulrun --profile-output) "
+			"to guide the Yul optimizer in assembly mode. Functions that were never called are optimized for size, "
+			"frequently called functions for gas. Only valid with a single input file."
+		)
+		(
+			g_strParallelAsmOptimizer.c_str(),
+			"Run the bytecode optimizer on independent sub-assemblies and basic blocks on several threads. "
+			"Does not change the generated code."
+		)
+		(
+			g_argIRCache.c_str(),
+			po::value<string>()->value_name("path"),
+			"Store the optimized IR and the bytecode generated from it in the given directory and re-use them "
+			"in later compilations of contracts whose IR and settings did not change (EXPERIMENTAL)."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -1351,6 +1382,42 @@ bool CommandLineInterface::processInput()
 			yulOptimiserSteps = m_args[g_strYulOptimizations].as<string>();
 		}
 
+		shared_ptr<yul::ExecutionProfile const> executionProfile;
+		if (m_args.count(g_strYulExecutionProfile))
+		{
+			if (!optimize)
+			{
+				serr() << "--" << g_strYulExecutionProfile << " is invalid if Yul optimizer is disabled" << endl;
+				return false;
+			}
+			// The profile identifies functions only by their position in the source.
+			if (m_sourceCodes.size() != 1)
+			{
+				serr() << "--" << g_strYulExecutionProfile << " can only be used with a single input file." << endl;
+				return false;
+			}
+
+			string const path = m_args[g_strYulExecutionProfile].as<string>();
+			Json::Value json;
+			optional<yul::ExecutionProfile> profile;
+			try
+			{
+				if (jsonParseStrict(readFileAsString(path), json))
+					profile = yul::ExecutionProfile::fromJson(json);
+			}
+			catch (FileNotFound const&)
+			{
+				serr() << "File not found: " << path << endl;
+				return false;
+			}
+			if (!profile)
+			{
+				serr() << "Invalid execution profile in --" << g_strYulExecutionProfile << ": " << path << endl;
+				return false;
+			}
+			executionProfile = make_shared<yul::ExecutionProfile const>(std::move(*profile));
+		}
+
 		if (m_args.count(g_argMachine))
 		{
 			string machine = m_args[g_argMachine].as<string>();
@@ -1408,7 +1475,7 @@ bool CommandLineInterface::processInput()
 			"Warning: Yul is still experimental. Please use the output with care." <<
 			endl;
 
-		return assemble(inputLanguage, targetMachine, optimize, yulOptimiserSteps);
+		return assemble(inputLanguage, targetMachine, optimize, yulOptimiserSteps, executionProfile);
 	}
 	else if (countEnabledOptions({g_strYulDialect, g_argMachine}) >= 1)
 	{
@@ -1416,6 +1483,11 @@ bool CommandLineInterface::processInput()
 		serr() << "are only valid in assembly mode." << endl;
 		return false;
 	}
+	else if (m_args.count(g_strYulExecutionProfile))
+	{
+		serr() << "--" << g_strYulExecutionProfile << " is only valid in assembly mode." << endl;
+		return false;
+	}
 
 	if (m_args.count(g_argLink))
 	{
@@ -1474,6 +1546,8 @@ bool CommandLineInterface::processInput()
 			m_compiler->setLibraries(m_libraries);
 		if (m_args.count(g_argExperimentalViaIR))
 			m_compiler->setViaIR(true);
+		if (m_args.count(g_argIRCache))
+			m_compiler->setIRCache(make_shared<IRCache>(m_args[g_argIRCache].as<string>()));
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
 		// TODO: Perhaps we should not compile unless requested
@@ -1506,6 +1580,7 @@ bool CommandLineInterface::processInput()
 			settings.yulOptimiserSteps = m_args[g_strYulOptimizations].as<string>();
 		}
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
+		settings.parallelAssemblyOptimiser = m_args.count(g_strParallelAsmOptimizer);
 		m_compiler->setOptimiserSettings(settings);
 
 		if (m_args.count(g_argImportAst))
@@ -1534,7 +1609,9 @@ bool CommandLineInterface::processInput()
 				m_compiler->setParserErrorRecovery(true);
 		}
 
+		util::Profiler::setEnabled(m_args.count(g_argProfile));
 		bool successful = m_compiler->compile(m_stopAfter);
+		util::Profiler::setEnabled(false);
 
 		for (auto const& error: m_compiler->errors())
 		{
@@ -1838,7 +1915,8 @@ bool CommandLineInterface::assemble(
 	yul::AssemblyStack::Language _language,
 	yul::AssemblyStack::Machine _targetMachine,
 	bool _optimize,
-	optional<string> _yulOptimiserSteps
+	optional<string> _yulOptimiserSteps,
+	shared_ptr<yul::ExecutionProfile const> _executionProfile
 )
 {
 	solAssert(_optimize || !_yulOptimiserSteps.has_value(), "");
@@ -1852,6 +1930,7 @@ bool CommandLineInterface::assemble(
 			settings.yulOptimiserSteps = _yulOptimiserSteps.value();
 
 		auto& stack = assemblyStacks[src.first] = yul::AssemblyStack(m_evmVersion, _language, settings);
+		stack.setExecutionProfile(_executionProfile);
 		try
 		{
 			if (!stack.parseAndAnalyze(src.first, src.second))
@@ -2036,6 +2115,9 @@ void CommandLineInterface::outputCompilationResults()
 		handleNatspec(false, contract);
 	} // end of contracts iteration
 
+	if (m_args.count(g_argProfile))
+		serr() << endl << "Profile:" << endl << util::Profiler::toString();
+
 	if (!g_hasOutput)
 	{
 		if (m_args.count(g_argOutputDir))
@@ -138,6 +138,8 @@ void EVMHost::reset()
 {
 	accounts.clear();
 	m_currentAddress = {};
+	m_journal.clear();
+	m_keepJournal = false;
 
 	// Mark all precompiled contracts as existing. Existing here means to have a balance (as per EIP-161).
 	// NOTE: keep this in sync with `EVMHost::call` below.
@@ -156,12 +158,69 @@ void EVMHost::reset()
 	}
 }
 
+void EVMHost::revertToSnapshot(size_t _snapshot)
+{
+	assertThrow(_snapshot <= m_journal.size(), Exception, "Invalid snapshot.");
+	revertJournal(_snapshot);
+}
+
+evmc_storage_status EVMHost::set_storage(
+	evmc::address const& _addr,
+	evmc::bytes32 const& _key,
+	evmc::bytes32 const& _value
+) noexcept
+{
+	if (auto account = accounts.find(_addr); account != accounts.end())
+	{
+		auto const& storage = account->second.storage;
+		if (auto slot = storage.find(_key); slot != storage.end())
+			m_journal.emplace_back([this, _addr, _key, oldValue = slot->second]() {
+				accounts[_addr].storage[_key] = oldValue;
+			});
+		else
+			m_journal.emplace_back([this, _addr, _key]() {
+				accounts[_addr].storage.erase(_key);
+			});
+	}
+	return MockedHost::set_storage(_addr, _key, _value);
+}
+
 void EVMHost::selfdestruct(const evmc::address& _addr, const evmc::address& _beneficiary) noexcept
 {
 	// TODO actual selfdestruct is even more complicated.
-	evmc::uint256be balance = accounts[_addr].balance;
+	evmc::uint256be balance = touchAccount(_addr).balance;
+	m_journal.emplace_back([this, _addr, account = accounts[_addr]]() {
+		accounts[_addr] = account;
+	});
 	accounts.erase(_addr);
-	accounts[_beneficiary].balance = balance;
+	touchAccount(_beneficiary);
+	setBalance(_beneficiary, balance);
+}
+
+evmc::MockedAccount& EVMHost::touchAccount(evmc::address const& _addr)
+{
+	auto [account, inserted] = accounts.try_emplace(_addr);
+	if (inserted)
+		m_journal.emplace_back([this, _addr]() { accounts.erase(_addr); });
+	return account->second;
+}
+
+void EVMHost::setBalance(evmc::address const& _addr, evmc::uint256be const& _balance)
+{
+	auto& account = accounts.at(_addr);
+	m_journal.emplace_back([this, _addr, oldBalance = account.balance]() {
+		accounts[_addr].balance = oldBalance;
+	});
+	account.balance = _balance;
+}
+
+void EVMHost::revertJournal(size_t _journalSize)
+{
+	while (m_journal.size() > _journalSize)
+	{
+		m_journal.back()();
+		m_journal.pop_back();
+	}
 }
 
 evmc::result EVMHost::call(evmc_message const& _message) noexcept
@@ -183,10 +242,10 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 	else if (_message.destination == 0x0000000000000000000000000000000000000008_address && m_evmVersion >= langutil::EVMVersion::byzantium())
 		return precompileALTBN128PairingProduct(_message);
 
-	auto const stateBackup = accounts;
+	size_t const journalSize = m_journal.size();
 
 	u256 value{convertFromEVMC(_message.value)};
-	auto& sender = accounts[_message.sender];
+	auto& sender = touchAccount(_message.sender);
 
 	evmc::bytes code;
 
@@ -200,7 +259,7 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 		{
 			evmc::result result({});
 			result.status_code = EVMC_OUT_OF_GAS;
-			accounts = stateBackup;
+			revertJournal(journalSize);
 			return result;
 		}
 	}
@@ -209,6 +268,9 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 	{
 		// TODO this is not the right formula
 		// TODO is the nonce incremented on failure, too?
+		m_journal.emplace_back([this, address = _message.sender, nonce = sender.nonce]() {
+			accounts[address].nonce = nonce;
+		});
 		h160 createAddress(keccak256(
 			bytes(begin(message.sender.bytes), end(message.sender.bytes)) +
 			asBytes(to_string(sender.nonce++))
@@ -232,7 +294,7 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 		{
 			evmc::result result({});
 			result.status_code = EVMC_OUT_OF_GAS;
-			accounts = stateBackup;
+			revertJournal(journalSize);
 			return result;
 		}
 
@@ -240,23 +302,23 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 	}
 	else if (message.kind == EVMC_DELEGATECALL)
 	{
-		code = accounts[message.destination].code;
+		code = touchAccount(message.destination).code;
 		message.destination = m_currentAddress;
 	}
 	else if (message.kind == EVMC_CALLCODE)
 	{
-		code = accounts[message.destination].code;
+		code = touchAccount(message.destination).code;
 		message.destination = m_currentAddress;
 	}
 	else
-		code = accounts[message.destination].code;
+		code = touchAccount(message.destination).code;
 
-	auto& destination = accounts[message.destination];
+	auto& destination = touchAccount(message.destination);
 
 	if (value != 0 && message.kind != EVMC_DELEGATECALL && message.kind != EVMC_CALLCODE)
 	{
-		sender.balance = convertToEVMC(u256(convertFromEVMC(sender.balance)) - value);
-		destination.balance = convertToEVMC(u256(convertFromEVMC(destination.balance)) + value);
+		setBalance(_message.sender, convertToEVMC(u256(convertFromEVMC(sender.balance)) - value));
+		setBalance(message.destination, convertToEVMC(u256(convertFromEVMC(destination.balance)) + value));
 	}
 
 	evmc::address currentAddress = m_currentAddress;
@@ -276,13 +338,24 @@ evmc::result EVMHost::call(evmc_message const& _message) noexcept
 		else
 		{
 			result.create_address = message.destination;
+			m_journal.emplace_back([
+				this,
+				address = message.destination,
+				code = destination.code,
+				codehash = destination.codehash
+			]() {
+				accounts[address].code = code;
+				accounts[address].codehash = codehash;
+			});
 			destination.code = evmc::bytes(result.output_data, result.output_data + result.output_size);
 			destination.codehash = convertToEVMC(keccak256({result.output_data, result.output_size}));
 		}
 	}
 
 	if (result.status_code != EVMC_SUCCESS)
-		accounts = stateBackup;
+		revertJournal(journalSize);
+	if (message.depth == 0 && !m_keepJournal)
+		m_journal.clear();
 
 	return result;
 }
@@ -32,6 +32,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include <functional>
+#include <vector>
+
 namespace solidity::test
 {
 using Address = util::h160;
@@ -55,6 +58,18 @@ public:
 	explicit EVMHost(langutil::EVMVersion _evmVersion, evmc::VM& _vm);
 
 	void reset();
+	/// Starts to keep a journal of all changes to the accounts made by subsequent calls.
+	/// @returns an identifier of the current state of the accounts that can be passed
+	/// to revertToSnapshot. Taking a snapshot does not copy any state.
+	size_t snapshot()
+	{
+		m_keepJournal = true;
+		return m_journal.size();
+	}
+	/// Restores the state of the accounts at the time the snapshot @a _snapshot was taken
+	/// in time proportional to the number of changes since then.
+	/// Changes made by modifying `accounts` directly are not undone.
+	void revertToSnapshot(size_t _snapshot);
 	void newBlock()
 	{
 		tx_context.block_number++;
@@ -67,6 +82,12 @@ public:
 		return evmc::MockedHost::account_exists(_addr);
 	}
 
+	evmc_storage_status set_storage(
+		evmc::address const& _addr,
+		evmc::bytes32 const& _key,
+		evmc::bytes32 const& _value
+	) noexcept final;
+
 	void selfdestruct(evmc::address const& _addr, evmc::address const& _beneficiary) noexcept final;
 
 	evmc::result call(evmc_message const& _message) noexcept final;
@@ -85,8 +106,22 @@ public:
 	}
 
 private:
+	/// @returns the account at address @a _addr, creating it (and recording the creation in the
+	/// journal) if it does not exist yet.
+	evmc::MockedAccount& touchAccount(evmc::address const& _addr);
+	/// Sets the balance of the account at address @a _addr, recording the old value in the journal.
+	void setBalance(evmc::address const& _addr, evmc::uint256be const& _balance);
+	/// Undoes the changes recorded in the journal after position @a _journalSize.
+	void revertJournal(size_t _journalSize);
+
 	evmc::address m_currentAddress = {};
 
+	/// Actions undoing the changes to the accounts made during calls, in the order of the changes.
+	/// Replaces copying the whole state at the start of every call.
+	std::vector<std::function<void()>> m_journal;
+	/// If false, the journal is cleared after every transaction.
+	bool m_keepJournal = false;
+
 	static evmc::result precompileECRecover(evmc_message const& _message) noexcept;
 	static evmc::result precompileSha256(evmc_message const& _message) noexcept;
 	static evmc::result precompileRipeMD160(evmc_message const& _message) noexcept;
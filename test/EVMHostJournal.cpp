@@ -0,0 +1,123 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the state journal of the EVM host.
+ */
+
+#include <test/EVMHost.h>
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::util;
+using namespace evmc::literals;
+
+namespace solidity::test
+{
+
+namespace
+{
+
+/// VM that successfully executes any code without doing anything, so that the host
+/// can be tested without loading an actual VM.
+evmc_result noopExecute(
+	evmc_vm*,
+	evmc_host_interface const*,
+	evmc_host_context*,
+	evmc_revision,
+	evmc_message const* _message,
+	uint8_t const*,
+	size_t
+)
+{
+	evmc_result result{};
+	result.status_code = EVMC_SUCCESS;
+	result.gas_left = _message->gas;
+	return result;
+}
+
+evmc_vm noopVM{
+	EVMC_ABI_VERSION,
+	"noop",
+	"0",
+	[](evmc_vm*) {},
+	noopExecute,
+	[](evmc_vm*) -> evmc_capabilities_flagset { return EVMC_CAPABILITY_EVM1; },
+	nullptr
+};
+
+void transfer(EVMHost& _host, evmc::address const& _from, evmc::address const& _to, u256 const& _value)
+{
+	evmc_message message{};
+	message.kind = EVMC_CALL;
+	message.gas = 1000000;
+	message.sender = _from;
+	message.destination = _to;
+	message.value = EVMHost::convertToEVMC(_value);
+	BOOST_REQUIRE(_host.call(message).status_code == EVMC_SUCCESS);
+}
+
+evmc::bytes32 word(u256 const& _value)
+{
+	return EVMHost::convertToEVMC(h256(_value));
+}
+
+u256 balance(EVMHost& _host, evmc::address const& _address)
+{
+	return u256(EVMHost::convertFromEVMC(_host.get_balance(_address)));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(EVMHostJournal)
+
+BOOST_AUTO_TEST_CASE(revert_to_snapshot)
+{
+	evmc::VM vm{&noopVM};
+	EVMHost host(CommonOptions::get().evmVersion(), vm);
+
+	auto const alice = 0x1111111111111111111111111111111111111111_address;
+	auto const bob = 0x2222222222222222222222222222222222222222_address;
+	evmc::bytes32 const key = word(1);
+	host.accounts[alice].balance = EVMHost::convertToEVMC(u256(1000));
+	host.set_storage(alice, key, word(10));
+
+	size_t snapshot = host.snapshot();
+	transfer(host, alice, bob, 100);
+	host.set_storage(alice, key, word(11));
+	host.set_storage(bob, key, word(12));
+	BOOST_CHECK_EQUAL(balance(host, alice), 900);
+	BOOST_CHECK_EQUAL(balance(host, bob), 100);
+	BOOST_CHECK(host.get_storage(alice, key) == word(11));
+
+	size_t nestedSnapshot = host.snapshot();
+	transfer(host, bob, alice, 50);
+	host.revertToSnapshot(nestedSnapshot);
+	BOOST_CHECK_EQUAL(balance(host, alice), 900);
+	BOOST_CHECK_EQUAL(balance(host, bob), 100);
+
+	host.revertToSnapshot(snapshot);
+	BOOST_CHECK_EQUAL(balance(host, alice), 1000);
+	BOOST_CHECK(host.get_storage(alice, key) == word(10));
+	BOOST_CHECK(!host.account_exists(bob));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,69 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the SMT-LIB2 output of SMTLib2Interface.
+ */
+
+#include <libsmtutil/SMTLib2Interface.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::smtutil::test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTLib2InterfaceTest)
+
+BOOST_AUTO_TEST_CASE(atomic_conversion_argument_is_not_bound)
+{
+	SMTLib2Interface smtlib2;
+	Expression x("x", {}, SortProvider::sintSort);
+	BOOST_CHECK_EQUAL(
+		smtlib2.toSExpr(Expression::int2bv(x, 8)),
+		"(ite (>= x 0) ((_ int2bv 8) x) (bvneg ((_ int2bv 8) (- x))))"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(nested_conversion_arguments_are_bound)
+{
+	SMTLib2Interface smtlib2;
+	Expression x("x", {}, SortProvider::sintSort);
+	Expression converted = Expression::bv2int(Expression::int2bv(x + 1, 8), true);
+	// Every argument is printed once, so the output grows linearly with the nesting depth.
+	// The inner binding shadows the outer name only inside its own body.
+	BOOST_CHECK_EQUAL(
+		smtlib2.toSExpr(converted),
+		"(let ((|bv argument| "
+			"(let ((|bv argument| (+ x 1))) "
+				"(ite (>= |bv argument| 0) ((_ int2bv 8) |bv argument|) (bvneg ((_ int2bv 8) (- |bv argument|)))))"
+		")) "
+			"(ite (= ((_ extract 7 7)|bv argument|) #b0) (bv2nat |bv argument|) (- (bvneg |bv argument|))))"
+	);
+
+	Expression deep = x;
+	for (size_t i = 0; i < 20; ++i)
+		deep = Expression::bv2int(Expression::int2bv(deep + 1, 8), true);
+	BOOST_CHECK_LT(smtlib2.toSExpr(deep).size(), 20 * 250);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
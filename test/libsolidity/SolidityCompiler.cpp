@@ -22,8 +22,17 @@
 #include <test/Metadata.h>
 #include <test/Common.h>
 
+#include <libsolidity/interface/IRCache.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <fstream>
+#include <functional>
+
 using namespace std;
 
 namespace solidity::frontend::test
@@ -51,6 +60,163 @@ BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions)
 	BOOST_CHECK(runtimeBytecode.size() <= 30);
 }
 
+BOOST_AUTO_TEST_CASE(ir_cache_reused_across_compilations)
+{
+	char const* sourceCode = R"(
+		contract C {
+			uint x;
+			function f(uint a) public returns (uint) { x += a; return x * 2; }
+		}
+	)";
+	auto cache = make_shared<IRCache>();
+	auto compile = [&]() {
+		CompilerStack compiler;
+		compiler.setSources({{"", sourceCode}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(OptimiserSettings::standard());
+		compiler.setViaIR(true);
+		compiler.setIRCache(cache);
+		BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+		return make_pair(compiler.object("C").bytecode, compiler.yulIROptimized("C"));
+	};
+
+	auto const first = compile();
+	BOOST_CHECK_EQUAL(cache->hits(), 0);
+	auto const second = compile();
+	BOOST_CHECK_EQUAL(cache->hits(), 2);
+	BOOST_CHECK(first.first == second.first);
+	BOOST_CHECK_EQUAL(first.second, second.second);
+}
+
+BOOST_AUTO_TEST_CASE(ir_cache_persisted_in_directory)
+{
+	char const* sourceCode = R"(
+		library L { function g(uint a) public pure returns (uint) { return a + 1; } }
+		contract C {
+			uint immutable y = 7;
+			function f(uint a) public view returns (uint) { return L.g(a) * y; }
+		}
+	)";
+	boost::filesystem::path directory =
+		boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("solc-ir-cache-%%%%-%%%%");
+	auto compile = [&](shared_ptr<IRCache> _cache) {
+		CompilerStack compiler;
+		compiler.setSources({{"", sourceCode}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(OptimiserSettings::standard());
+		compiler.setViaIR(true);
+		compiler.setIRCache(_cache);
+		BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+		return make_pair(compiler.object("C"), compiler.runtimeObject("C"));
+	};
+
+	auto firstCache = make_shared<IRCache>(directory);
+	auto const first = compile(firstCache);
+	BOOST_CHECK_EQUAL(firstCache->hits(), 0);
+
+	// A new cache instance only sees the results of the first compilation through the directory.
+	auto secondCache = make_shared<IRCache>(directory);
+	auto const second = compile(secondCache);
+	BOOST_CHECK_EQUAL(secondCache->hits(), 4);
+	BOOST_CHECK_EQUAL(secondCache->misses(), 0);
+	boost::filesystem::remove_all(directory);
+
+	BOOST_REQUIRE(!first.first.linkReferences.empty());
+	BOOST_REQUIRE(!first.second.immutableReferences.empty());
+	for (auto const& [firstObject, secondObject]: {make_pair(first.first, second.first), make_pair(first.second, second.second)})
+	{
+		BOOST_CHECK(firstObject.bytecode == secondObject.bytecode);
+		BOOST_CHECK(firstObject.linkReferences == secondObject.linkReferences);
+		BOOST_CHECK(firstObject.immutableReferences == secondObject.immutableReferences);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ir_cache_ignores_corrupted_entries)
+{
+	char const* sourceCode = R"(
+		contract C {
+			uint immutable y = 7;
+			function f(uint a) public view returns (uint) { return a * y; }
+		}
+	)";
+	boost::filesystem::path directory =
+		boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("solc-ir-cache-%%%%-%%%%");
+	auto compile = [&](shared_ptr<IRCache> _cache) {
+		CompilerStack compiler;
+		compiler.setSources({{"", sourceCode}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(OptimiserSettings::standard());
+		compiler.setViaIR(true);
+		compiler.setIRCache(_cache);
+		BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+		return compiler.runtimeObject("C");
+	};
+	// Overwrites every bytecode entry in the directory with a modified version.
+	auto corrupt = [&](function<void(Json::Value&)> const& _modify) {
+		for (auto const& entry: boost::filesystem::directory_iterator(directory))
+			if (entry.path().extension() == ".json")
+			{
+				Json::Value json;
+				BOOST_REQUIRE(util::jsonParseStrict(util::readFileAsString(entry.path().string()), json));
+				_modify(json);
+				ofstream(entry.path().string(), ios::binary) << util::jsonCompactPrint(json);
+			}
+	};
+
+	auto const expectation = compile(make_shared<IRCache>(directory));
+	BOOST_REQUIRE(!expectation.immutableReferences.empty());
+
+	vector<function<void(Json::Value&)>> corruptions{
+		[](Json::Value& _json) { _json["runtime"]["bytecode"] = "zz" + _json["runtime"]["bytecode"].asString(); },
+		[](Json::Value& _json) { _json["runtime"]["immutableReferences"][0][0] = "0xnothex"; },
+		[](Json::Value& _json) { _json["runtime"]["immutableReferences"][0][0] = "0x" + string(65, '1'); }
+	};
+	for (auto const& corruption: corruptions)
+	{
+		corrupt(corruption);
+		auto cache = make_shared<IRCache>(directory);
+		auto const result = compile(cache);
+		BOOST_CHECK_EQUAL(cache->misses(), 1);
+		BOOST_CHECK(result.bytecode == expectation.bytecode);
+		BOOST_CHECK(result.immutableReferences == expectation.immutableReferences);
+	}
+	boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_assembly_optimiser)
+{
+	string sourceCode = R"(
+		contract A { uint x; function f(uint a) public { x = a * 3 + 1; } }
+		contract B { uint y; function g(uint b) public returns (uint) { y = b; return b * 2; } }
+		contract C {
+			uint[] values;
+			function a() public returns (address) { return address(new A()); }
+			function b() public returns (address) { return address(new B()); }
+	)";
+	// Many small functions result in enough basic blocks to distribute them over several threads.
+	for (size_t i = 0; i < 40; ++i)
+		sourceCode +=
+			"function f" + to_string(i) + "(uint v) public returns (uint) { " +
+			"if (v > " + to_string(i) + ") values.push(v + " + to_string(i) + "); " +
+			"return values.length * " + to_string(i + 2) + "; }\n";
+	sourceCode += "}";
+
+	auto compile = [&](bool _parallel) {
+		CompilerStack compiler;
+		compiler.setSources({{"", sourceCode}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		OptimiserSettings settings = OptimiserSettings::standard();
+		settings.parallelAssemblyOptimiser = _parallel;
+		compiler.setOptimiserSettings(settings);
+		BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+		return compiler.object("C").bytecode;
+	};
+	// Run several times to increase the chance of detecting non-deterministic results.
+	bytes const sequential = compile(false);
+	for (size_t i = 0; i < 3; ++i)
+		BOOST_CHECK(compile(true) == sequential);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
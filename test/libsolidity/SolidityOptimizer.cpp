@@ -723,6 +723,53 @@ BOOST_AUTO_TEST_CASE(avoid_double_cleanup)
 	BOOST_CHECK_EQUAL(numInstructions(m_nonOptimizedBytecode, Instruction::AND), 1);
 }
 
+BOOST_AUTO_TEST_CASE(via_ir_evmasm_optimiser)
+{
+	char const* sourceCode = R"(
+		contract C {
+			function f(uint a, uint b, uint[] memory c) public returns (uint r, uint s) {
+				for (uint i = 0; i < c.length; i++)
+				{
+					uint t = (a * c[i] + b) / (i + 1);
+					r += t;
+					s ^= t << i;
+				}
+			}
+		}
+	)";
+	auto instructions = [](bytes const& _bytecode) {
+		size_t count = 0;
+		evmasm::eachInstruction(_bytecode, [&](Instruction, u256 const&) { count++; });
+		return count;
+	};
+	OptimiserSettings previousSettings = m_optimiserSettings;
+	m_compileViaYul = true;
+
+	vector<bytes> outputs;
+	vector<u256> gasUsed;
+	vector<size_t> codeSize;
+	for (bool evmasmOptimiser: {false, true})
+	{
+		m_optimiserSettings = OptimiserSettings::standard();
+		m_optimiserSettings.runEVMAssemblyOptimiser = evmasmOptimiser;
+		codeSize.push_back(instructions(compileAndRun(sourceCode)));
+		outputs.push_back(callContractFunction("f(uint256,uint256,uint256[])", 3, 5, 0x60, 4, 1, 2, 3, 4));
+		gasUsed.push_back(m_gasUsed);
+	}
+	m_optimiserSettings = previousSettings;
+
+	BOOST_CHECK(!outputs[0].empty());
+	BOOST_CHECK(outputs[0] == outputs[1]);
+	BOOST_CHECK_MESSAGE(
+		codeSize[1] < codeSize[0],
+		"The evmasm optimiser did not reduce code size: " + to_string(codeSize[0]) + " -> " + to_string(codeSize[1])
+	);
+	BOOST_CHECK_MESSAGE(
+		gasUsed[1] <= gasUsed[0],
+		"The evmasm optimiser increased gas usage: " + toString(gasUsed[0]) + " -> " + toString(gasUsed[1])
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
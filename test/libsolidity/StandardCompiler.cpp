@@ -1755,6 +1755,54 @@ BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract_yul)
 	BOOST_REQUIRE(result["sources"].size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(profiling)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"profiling": true,
+			"optimizer": { "enabled": true, "details": { "yul": true } },
+			"outputSelection": {
+				"fileA": { "A": [ "evm.bytecode.object" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f(uint[] calldata x) public pure returns (uint) { return x[1]; } }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result["profiling"].isObject());
+	for (string phase: {"parsing", "analysis/typeChecker", "codegen/compileContract", "evmasm/optimise"})
+	{
+		BOOST_REQUIRE(result["profiling"][phase].isObject());
+		BOOST_CHECK(result["profiling"][phase]["time"].isInt64());
+		BOOST_CHECK(result["profiling"][phase]["count"].asUInt() >= 1);
+	}
+	BOOST_CHECK(result["profiling"]["yul/ExpressionSimplifier"]["codeSizeDelta"].isInt64());
+
+	input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"profiling": 1
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.profiling\" must be a Boolean."));
+	BOOST_CHECK(!result.isMember("profiling"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
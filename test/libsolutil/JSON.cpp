@@ -70,6 +70,23 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK("{\"1\":1,\"2\":\"2\",\"3\":{\"3.1\":\"3.1\",\"3.2\":2}}" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(remove_null_members)
+{
+	Json::Value json;
+	Json::Value jsonChild;
+
+	jsonChild["3.1"] = Json::nullValue;
+	jsonChild["3.2"] = 2;
+	json["1"] = Json::nullValue;
+	json["2"] = "2";
+	json["3"] = jsonChild;
+	json["4"] = Json::arrayValue;
+	json["4"].append(Json::nullValue);
+	json["4"].append(jsonChild);
+
+	BOOST_CHECK("{\"2\":\"2\",\"3\":{\"3.2\":2},\"4\":[null,{\"3.2\":2}]}" == jsonCompactPrint(removeNullMembers(json)));
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_strict)
 {
 	Json::Value json;
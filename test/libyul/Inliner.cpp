@@ -22,14 +22,21 @@
 
 #include <test/libyul/Common.h>
 
+#include <libyul/optimiser/ExecutionProfile.h>
 #include <libyul/optimiser/ExpressionInliner.h>
+#include <libyul/optimiser/ExpressionSplitter.h>
 #include <libyul/optimiser/InlinableExpressionFunctionFinder.h>
 #include <libyul/optimiser/FullInliner.h>
 #include <libyul/optimiser/FunctionHoister.h>
 #include <libyul/optimiser/FunctionGrouper.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/AST.h>
 
+#include <test/Common.h>
+
 #include <boost/test/unit_test.hpp>
 
 #include <boost/range/adaptors.hpp>
@@ -56,6 +63,37 @@ string inlinableFunctions(string const& _source)
 	return boost::algorithm::join(functionNames, ",");
 }
 
+/// Runs the full inliner on @a _source, guided by the given number of calls per function
+/// if @a _calls is not empty.
+/// @returns the names of the functions that still call @a _callee.
+string functionsCalling(string const& _source, string const& _callee, map<string, size_t> const& _calls)
+{
+	Block ast = disambiguate(_source, false);
+	ExecutionProfile profile;
+	for (auto const& statement: ast.statements)
+		if (auto const* function = get_if<FunctionDefinition>(&statement))
+			if (_calls.count(function->name.str()))
+				profile.recordCalls(function->location, _calls.at(function->name.str()));
+
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	NameDispenser dispenser{dialect, ast};
+	set<YulString> reservedIdentifiers;
+	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers};
+	if (!_calls.empty())
+		context.profile = &profile;
+	FunctionHoister::run(context, ast);
+	FunctionGrouper::run(context, ast);
+	ExpressionSplitter::run(context, ast);
+	FullInliner::run(context, ast);
+
+	vector<string> functionNames;
+	for (auto const& statement: ast.statements)
+		if (auto const* function = get_if<FunctionDefinition>(&statement))
+			if (AsmPrinter{}(function->body).find(_callee + "(") != string::npos)
+				functionNames.emplace_back(function->name.str());
+	return boost::algorithm::join(functionNames, ",");
+}
+
 }
 
 
@@ -109,4 +147,42 @@ BOOST_AUTO_TEST_CASE(negative)
 }
 
 
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(YulFullInlinerProfile)
+
+BOOST_AUTO_TEST_CASE(cold_and_hot_functions)
+{
+	string const source = R"({
+		function g(a) -> b { b := add(mul(a, sload(a)), 7) }
+		function f(x) -> y { y := g(x) }
+		function h(x) -> y { y := g(x) }
+		sstore(0, f(calldataload(0)))
+		sstore(1, f(calldataload(32)))
+		sstore(2, h(calldataload(64)))
+		sstore(3, h(calldataload(96)))
+	})";
+	BOOST_CHECK_EQUAL(functionsCalling(source, "g", {}), "");
+	BOOST_CHECK_EQUAL(functionsCalling(source, "g", {{"f", 10}, {"h", 0}, {"g", 10}}), "h");
+	// Functions that are not part of the profile are treated as without profile.
+	BOOST_CHECK_EQUAL(functionsCalling(source, "g", {{"g", 10}}), "");
+}
+
+BOOST_AUTO_TEST_CASE(larger_function_inlined_into_hot_function)
+{
+	// g is too large to be inlined without a profile, but small enough for the doubled
+	// size limit inside hot functions. h is called, but not often enough to be hot.
+	string const source = R"({
+		function g(a) -> b { b := add(mul(a, sload(a)), div(sload(add(a, 1)), calldataload(a))) }
+		function f(x) -> y { y := g(x) }
+		function h(x) -> y { y := g(x) }
+		sstore(0, f(calldataload(0)))
+		sstore(1, f(calldataload(32)))
+		sstore(2, h(calldataload(64)))
+		sstore(3, h(calldataload(96)))
+	})";
+	BOOST_CHECK_EQUAL(functionsCalling(source, "g", {}), "f,h");
+	BOOST_CHECK_EQUAL(functionsCalling(source, "g", {{"f", 100}, {"h", 1}}), "h");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of optimised Yul objects.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/optimiser/OptimisedObjectCache.h>
+
+#include <liblangutil/Scanner.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+using namespace std;
+using namespace solidity::frontend;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string const c_created = R"(
+	object "B" {
+		code {
+			datacopy(0, dataoffset("B_deployed"), datasize("B_deployed"))
+			return(0, datasize("B_deployed"))
+		}
+		object "B_deployed" {
+			code {
+				function double(x) -> r { r := add(x, x) }
+				function store(key, value) { sstore(key, double(value)) }
+				store(0, calldataload(0))
+				store(1, calldataload(32))
+			}
+		}
+	}
+)";
+
+string const c_creator = R"(
+	object "A" {
+		code {
+			datacopy(0, dataoffset("B"), datasize("B"))
+			sstore(0, create(0, 0, datasize("B")))
+		}
+)" + c_created + R"(
+	}
+)";
+
+string optimise(string const& _source, shared_ptr<OptimisedObjectCache> _cache)
+{
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		OptimiserSettings::full()
+	);
+	stack.setOptimisedObjectCache(move(_cache));
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	stack.optimize();
+	return stack.print();
+}
+
+/// @returns the source locations of the optimised code of the object at @a _path as pairs
+/// of start and end after checking that they refer to the parsed source.
+vector<pair<int, int>> optimisedLocations(
+	string const& _source,
+	vector<string> const& _path,
+	shared_ptr<OptimisedObjectCache> _cache
+)
+{
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		OptimiserSettings::full()
+	);
+	stack.setOptimisedObjectCache(move(_cache));
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	stack.optimize();
+
+	Object const* object = stack.parserResult().get();
+	for (string const& name: _path)
+	{
+		object = dynamic_cast<Object const*>(object->subObjects.at(object->subIndexByName.at(YulString{name})).get());
+		BOOST_REQUIRE(object);
+	}
+	vector<pair<int, int>> result;
+	for (langutil::SourceLocation const& location: OptimisedObjectCache::sourceLocations(*object->code))
+	{
+		if (location.isValid())
+			BOOST_REQUIRE(location.source == stack.scanner().charStream());
+		result.emplace_back(location.start, location.end);
+	}
+	return result;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimisedObjectCache)
+
+BOOST_AUTO_TEST_CASE(created_object_is_optimised_once)
+{
+	auto cache = make_shared<OptimisedObjectCache>();
+
+	optimise(c_created, cache);
+	BOOST_CHECK_EQUAL(cache->hits(), 0);
+	BOOST_CHECK_EQUAL(cache->misses(), 2);
+
+	// Only the deployed object is reused, since the gas meter optimises the
+	// top-level object "B" for creation but not the nested one.
+	string creator = optimise(c_creator, cache);
+	BOOST_CHECK_EQUAL(cache->hits(), 1);
+	BOOST_CHECK_EQUAL(cache->misses(), 4);
+
+	BOOST_CHECK_EQUAL(creator, optimise(c_creator, nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(locations_refer_to_the_current_source)
+{
+	auto cache = make_shared<OptimisedObjectCache>();
+
+	optimise(c_created, cache);
+	vector<pair<int, int>> locations = optimisedLocations(c_creator, {"B", "B_deployed"}, cache);
+	BOOST_CHECK_EQUAL(cache->hits(), 1);
+
+	// The object is nested deeper in the creator, so its locations differ from those in c_created.
+	BOOST_CHECK(locations != optimisedLocations(c_created, {"B_deployed"}, nullptr));
+	BOOST_CHECK(locations == optimisedLocations(c_creator, {"B", "B_deployed"}, nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(settings_are_part_of_the_key)
+{
+	auto cache = make_shared<OptimisedObjectCache>();
+
+	OptimiserSettings settings = OptimiserSettings::full();
+	for (string const& steps: {settings.yulOptimiserSteps, string("dhfoDgvulfnTUtnIf"), settings.yulOptimiserSteps})
+	{
+		settings.yulOptimiserSteps = steps;
+		AssemblyStack stack(
+			solidity::test::CommonOptions::get().evmVersion(),
+			AssemblyStack::Language::StrictAssembly,
+			settings
+		);
+		stack.setOptimisedObjectCache(cache);
+		BOOST_REQUIRE(stack.parseAndAnalyze("", c_created));
+		stack.optimize();
+	}
+	BOOST_CHECK_EQUAL(cache->hits(), 2);
+	BOOST_CHECK_EQUAL(cache->misses(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
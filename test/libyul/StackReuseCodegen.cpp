@@ -32,11 +32,12 @@ namespace solidity::yul::test
 
 namespace
 {
-string assemble(string const& _input)
+string assemble(string const& _input, bool _runEVMAssemblyOptimiser = false)
 {
 	solidity::frontend::OptimiserSettings settings = solidity::frontend::OptimiserSettings::full();
 	settings.runYulOptimiser = false;
 	settings.optimizeStackAllocation = true;
+	settings.runEVMAssemblyOptimiser = _runEVMAssemblyOptimiser;
 	AssemblyStack asmStack(langutil::EVMVersion{}, AssemblyStack::Language::StrictAssembly, settings);
 	BOOST_REQUIRE_MESSAGE(asmStack.parseAndAnalyze("", _input), "Source did not parse: " + _input);
 	return evmasm::disassemble(asmStack.assemble(AssemblyStack::Machine::EVM).bytecode->bytecode);
@@ -408,6 +409,26 @@ BOOST_AUTO_TEST_CASE(reuse_on_decl_assign_not_same_scope)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(evmasm_optimiser)
+{
+	string in = R"({
+		let z := calldataload(0)
+		{ let x := calldataload(0x20) x := add(x, 1) z := mul(z, x) }
+		{ let x := z z := add(x, z) x := 4 }
+		sstore(0, z)
+	})";
+	BOOST_CHECK_EQUAL(assemble(in),
+		"PUSH1 0x0 CALLDATALOAD "
+		"PUSH1 0x20 CALLDATALOAD PUSH1 0x1 DUP2 ADD SWAP1 POP DUP1 DUP3 MUL SWAP2 POP POP "
+		"DUP1 DUP2 DUP2 ADD SWAP2 POP PUSH1 0x4 SWAP1 POP POP "
+		"DUP1 PUSH1 0x0 SSTORE POP "
+	);
+	// The common subexpression eliminator re-generates the stack operations of the whole block.
+	BOOST_CHECK_EQUAL(assemble(in, true),
+		"PUSH1 0x0 DUP1 CALLDATALOAD PUSH1 0x20 CALLDATALOAD PUSH1 0x1 ADD MUL DUP1 ADD SWAP1 SSTORE "
+	);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -32,6 +32,7 @@
 #include <libyul/optimiser/CircularReferencesPruner.h>
 #include <libyul/optimiser/ConditionalUnsimplifier.h>
 #include <libyul/optimiser/ConditionalSimplifier.h>
+#include <libyul/optimiser/ConstantArgumentPropagator.h>
 #include <libyul/optimiser/CommonSubexpressionEliminator.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/EquivalentFunctionCombiner.h>
@@ -183,6 +184,11 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		disambiguate();
 		ConditionalSimplifier::run(*m_context, *m_object->code);
 	}
+	else if (m_optimizerStep == "constantArgumentPropagator")
+	{
+		disambiguate();
+		ConstantArgumentPropagator::run(*m_context, *m_object->code);
+	}
 	else if (m_optimizerStep == "expressionSplitter")
 		ExpressionSplitter::run(*m_context, *m_object->code);
 	else if (m_optimizerStep == "expressionJoiner")
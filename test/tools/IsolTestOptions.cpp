@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <regex>
+#include <stdexcept>
 #include <string>
 
 namespace fs = boost::filesystem;
@@ -63,7 +64,14 @@ IsolTestOptions::IsolTestOptions(std::string* _editor):
 		("editor", po::value<std::string>(_editor)->default_value(editorPath()), "Path to editor for opening test files.")
 		("help", po::bool_switch(&showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor), "Don't use colors.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		(
+			"shard",
+			po::value<std::string>(&shard)->default_value("0/1"),
+			"Only run the tests in shard i of n (given as i/n with 0 <= i < n). "
+			"Tests are assigned to shards deterministically based on their name, "
+			"so that n isoltest processes with distinct shards run every test exactly once."
+		);
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -77,6 +85,22 @@ bool IsolTestOptions::parse(int _argc, char const* const* _argv)
 	}
 	enforceViaYul = true;
 
+	std::smatch match;
+	assertThrow(
+		std::regex_match(shard, match, std::regex{"([0-9]+)/([0-9]+)"}),
+		ConfigException,
+		"Invalid shard - has to be of the form i/n: " + shard
+	);
+	try
+	{
+		shardIndex = std::stoul(match[1]);
+		shardCount = std::stoul(match[2]);
+	}
+	catch (std::out_of_range const&)
+	{
+		assertThrow(false, ConfigException, "Invalid shard - has to be of the form i/n: " + shard);
+	}
+
 	return res;
 }
 
@@ -89,6 +113,11 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(
+		shardIndex < shardCount,
+		ConfigException,
+		"Invalid shard - the index has to be less than the number of shards: " + shard
+	);
 }
 
 }
@@ -32,10 +32,16 @@ struct IsolTestOptions: CommonOptions
 	bool showHelp = false;
 	bool noColor = false;
 	std::string testFilter = std::string{};
+	/// Index of the shard to run and total number of shards, parsed from "--shard i/n".
+	size_t shardIndex = 0;
+	size_t shardCount = 1;
 
 	IsolTestOptions(std::string* _editor);
 	bool parse(int _argc, char const* const* _argv) override;
 	void validate() const override;
+
+private:
+	std::string shard = std::string{};
 };
 
 }
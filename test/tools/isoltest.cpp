@@ -18,6 +18,7 @@
 
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/AnsiColorized.h>
+#include <libsolutil/Keccak256.h>
 
 #include <memory>
 #include <test/Common.h>
@@ -69,7 +70,10 @@ struct TestStats
 class TestFilter
 {
 public:
-	explicit TestFilter(string _filter): m_filter(std::move(_filter))
+	explicit TestFilter(string _filter, size_t _shardIndex = 0, size_t _shardCount = 1):
+		m_filter(std::move(_filter)),
+		m_shardIndex(_shardIndex),
+		m_shardCount(_shardCount)
 	{
 		string filter{m_filter};
 
@@ -81,12 +85,23 @@ public:
 
 	bool matches(string const& _name) const
 	{
-		return regex_match(_name, m_filterExpression);
+		return regex_match(_name, m_filterExpression) && inShard(_name);
 	}
 
 private:
+	/// Assigns tests to shards based on the hash of their name, which does not depend on the
+	/// order in which the file system lists the test files.
+	bool inShard(string const& _name) const
+	{
+		if (m_shardCount == 1)
+			return true;
+		return u256(keccak256(_name)) % m_shardCount == m_shardIndex;
+	}
+
 	string m_filter;
 	regex m_filterExpression;
+	size_t m_shardIndex;
+	size_t m_shardCount;
 };
 
 class TestTool
@@ -100,7 +115,7 @@ public:
 	):
 		m_testCaseCreator(_testCaseCreator),
 		m_options(_options),
-		m_filter(TestFilter{_options.testFilter}),
+		m_filter(TestFilter{_options.testFilter, _options.shardIndex, _options.shardCount}),
 		m_path(std::move(_path)),
 		m_name(std::move(_name))
 	{}
@@ -0,0 +1,409 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compiler throughput benchmark. Compiles fixed corpora through the different
+ * pipelines and reports the time spent per compiler phase as JSON.
+ */
+
+#include <test/TestCaseReader.h>
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/IRCache.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libyul/YulString.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Profiler.h>
+#include <libsolutil/Whiskers.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+struct Pipeline
+{
+	string name;
+	bool optimize;
+	bool viaIR;
+};
+
+vector<Pipeline> const c_pipelines{
+	{"legacy", false, false},
+	{"legacy-optimize", true, false},
+	{"via-ir-optimize", true, true},
+};
+
+/// Set of sources that is compiled together.
+struct CompilationUnit
+{
+	string name;
+	StringMap sources;
+};
+
+/// Every Solidity file below @a _directory is a separate unit, which can contain multiple
+/// sources in the format of the test files.
+void addTestFiles(fs::path const& _directory, vector<CompilationUnit>& _units)
+{
+	vector<fs::path> files;
+	for (auto const& entry: fs::recursive_directory_iterator(_directory))
+		if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+			files.push_back(entry.path());
+	sort(files.begin(), files.end());
+	for (auto const& file: files)
+	{
+		frontend::test::TestCaseReader reader(file.string());
+		StringMap sources;
+		for (auto const& [name, content]: reader.sources().sources)
+			sources[name.empty() ? file.filename().string() : name] = content;
+		_units.push_back({file.string(), move(sources)});
+	}
+}
+
+/// Every sub-directory of @a _directory is a separate project and all Solidity files in it
+/// are compiled together.
+void addProjects(fs::path const& _directory, vector<CompilationUnit>& _units)
+{
+	vector<fs::path> projects;
+	for (auto const& entry: fs::directory_iterator(_directory))
+		if (fs::is_directory(entry.path()))
+			projects.push_back(entry.path());
+	sort(projects.begin(), projects.end());
+	for (auto const& project: projects)
+	{
+		CompilationUnit unit{project.string(), {}};
+		for (auto const& entry: fs::recursive_directory_iterator(project))
+			if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+				unit.sources[fs::relative(entry.path(), project).generic_string()] = readFileAsString(entry.path().string());
+		if (!unit.sources.empty())
+			_units.push_back(move(unit));
+	}
+}
+
+/// @returns a contract with @a _functions functions that exercise arithmetic, storage,
+/// loops, memory arrays and ABI coding.
+CompilationUnit syntheticContract(size_t _functions)
+{
+	string functions;
+	for (size_t i = 0; i < _functions; ++i)
+		functions += Whiskers(R"(
+	function f<i>(uint a, uint[] calldata b, bytes memory c) public returns (uint r, bytes memory d) {
+		for (uint i = 0; i < b.length; i++)
+			r += b[i] * (a + <i>) / (i + 1);
+		values[a] = r;
+		if (r > values[a + 1])
+			emit Updated(a, r);
+		d = abi.encode(r, c, b[<i> % (b.length + 1)]);
+		s.x = uint128(r);
+		s.y = keccak256(d);
+	}
+)")("i", to_string(i)).render();
+
+	string contract = Whiskers(R"(
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+pragma abicoder v2;
+contract Synthetic {
+	struct S { uint128 x; bytes32 y; }
+	event Updated(uint indexed key, uint value);
+	mapping(uint => uint) values;
+	S s;
+	<functions>
+}
+)")("functions", functions).render();
+
+	return {"synthetic" + to_string(_functions), {{"synthetic.sol", contract}}};
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/// Runs @a _run in a child process, so that its peak resident set size is not mixed up with
+/// that of earlier runs.
+/// @returns the JSON value returned by @a _run with the peak resident set size of the child
+/// in kilobytes added as "peakRSS", or nullopt if the child process could not be run.
+optional<Json::Value> runInChildProcess(function<Json::Value()> const& _run)
+{
+	int fds[2];
+	if (pipe(fds) != 0)
+		return nullopt;
+	cout.flush();
+	cerr.flush();
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return nullopt;
+	}
+	if (pid == 0)
+	{
+		close(fds[0]);
+		string const result = jsonCompactPrint(_run());
+		for (size_t written = 0; written < result.size();)
+		{
+			ssize_t count = write(fds[1], result.data() + written, result.size() - written);
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count <= 0)
+				_exit(1);
+			written += static_cast<size_t>(count);
+		}
+		_exit(0);
+	}
+
+	close(fds[1]);
+	string output;
+	char buffer[4096];
+	for (ssize_t count; (count = read(fds[0], buffer, sizeof(buffer))) != 0;)
+		if (count > 0)
+			output.append(buffer, static_cast<size_t>(count));
+		else if (errno != EINTR)
+			break;
+	close(fds[0]);
+
+	int status = 0;
+	rusage usage;
+	if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		return nullopt;
+	Json::Value result;
+	if (!jsonParseStrict(output, result))
+		return nullopt;
+#if defined(__APPLE__)
+	result["peakRSS"] = Json::UInt64(static_cast<size_t>(usage.ru_maxrss) / 1024);
+#else
+	result["peakRSS"] = Json::UInt64(static_cast<size_t>(usage.ru_maxrss));
+#endif
+	return result;
+}
+#endif
+
+Json::Value runPipeline(
+	Pipeline const& _pipeline,
+	vector<CompilationUnit> const& _units,
+	size_t _repetitions,
+	bool _useIRCache
+)
+{
+	size_t failures = 0;
+	shared_ptr<IRCache> irCache = _useIRCache ? make_shared<IRCache>() : nullptr;
+	Profiler::reset();
+	Profiler::setEnabled(true);
+	auto start = chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < _repetitions; ++repetition)
+		for (CompilationUnit const& unit: _units)
+		{
+			yul::YulStringRepository::reset();
+			CompilerStack compiler;
+			compiler.setSources(unit.sources);
+			compiler.setOptimiserSettings(_pipeline.optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal());
+			compiler.setViaIR(_pipeline.viaIR);
+			compiler.setIRCache(irCache);
+			try
+			{
+				if (!compiler.compile())
+					failures++;
+			}
+			catch (...)
+			{
+				failures++;
+			}
+		}
+	auto time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+	Profiler::setEnabled(false);
+
+	Json::Value result{Json::objectValue};
+	result["time"] = Json::Int64(time.count());
+	result["units"] = Json::UInt64(_units.size() * _repetitions);
+	result["failures"] = Json::UInt64(failures);
+	result["phases"] = Profiler::toJson();
+	if (irCache)
+	{
+		result["irCache"]["hits"] = Json::UInt64(irCache->hits());
+		result["irCache"]["misses"] = Json::UInt64(irCache->misses());
+	}
+	return result;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench, compiler throughput benchmark.
+Usage: solbench [Options]
+Compiles the given corpora through the selected pipelines and
+prints the time spent per compiler phase (in microseconds) as JSON.
+Where supported, every pipeline runs in a separate process and its
+peak resident set size (in kilobytes) is reported as "peakRSS".
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		(
+			"test-files",
+			po::value<vector<string>>()->value_name("path"),
+			"Directory whose Solidity files (in test file format, e.g. test/libsolidity/semanticTests) are compiled one by one."
+		)
+		(
+			"projects",
+			po::value<vector<string>>()->value_name("path"),
+			"Directory whose sub-directories (e.g. test/compilationTests) are compiled as one project each."
+		)
+		(
+			"synthetic",
+			po::value<vector<size_t>>()->value_name("functions"),
+			"Compile a generated contract with the given number of functions."
+		)
+		(
+			"pipeline",
+			po::value<vector<string>>()->value_name("name"),
+			"Pipeline to run: legacy, legacy-optimize or via-ir-optimize. Runs all if not given."
+		)
+		(
+			"repetitions",
+			po::value<size_t>()->value_name("n")->default_value(1),
+			"Number of times every unit is compiled."
+		)
+		(
+			"ir-cache",
+			"Share a cache of the optimised IR between all compilations of a pipeline, "
+			"so that repeated compilations of unchanged contracts skip the Yul optimiser."
+		)
+		(
+			"output",
+			po::value<string>()->value_name("file"),
+			"Write the result to the given file instead of stdout."
+		)
+		("help", "Show this help screen.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	vector<CompilationUnit> units;
+	try
+	{
+		if (arguments.count("test-files"))
+			for (string const& path: arguments["test-files"].as<vector<string>>())
+				addTestFiles(path, units);
+		if (arguments.count("projects"))
+			for (string const& path: arguments["projects"].as<vector<string>>())
+				addProjects(path, units);
+	}
+	catch (std::exception const& _exception)
+	{
+		cerr << "Error reading the corpus: " << _exception.what() << endl;
+		return 1;
+	}
+	if (arguments.count("synthetic"))
+		for (size_t functions: arguments["synthetic"].as<vector<size_t>>())
+			units.push_back(syntheticContract(functions));
+
+	if (units.empty())
+	{
+		cerr << "No input given." << endl << endl << options;
+		return 1;
+	}
+
+	vector<Pipeline> pipelines;
+	if (arguments.count("pipeline"))
+		for (string const& name: arguments["pipeline"].as<vector<string>>())
+		{
+			auto pipeline = find_if(c_pipelines.begin(), c_pipelines.end(), [&](Pipeline const& _p) { return _p.name == name; });
+			if (pipeline == c_pipelines.end())
+			{
+				cerr << "Unknown pipeline: " << name << endl;
+				return 1;
+			}
+			pipelines.push_back(*pipeline);
+		}
+	else
+		pipelines = c_pipelines;
+
+	Json::Value output{Json::objectValue};
+	output["pipelines"] = Json::objectValue;
+	for (Pipeline const& pipeline: pipelines)
+	{
+		auto run = [&]() {
+			return runPipeline(
+				pipeline,
+				units,
+				arguments["repetitions"].as<size_t>(),
+				arguments.count("ir-cache") > 0
+			);
+		};
+		// Every pipeline runs in its own process where possible, so that "peakRSS" is
+		// the memory used by that pipeline alone.
+		optional<Json::Value> result;
+#if defined(__unix__) || defined(__APPLE__)
+		result = runInChildProcess(run);
+#endif
+		output["pipelines"][pipeline.name] = result ? move(*result) : run();
+	}
+
+	if (arguments.count("output"))
+	{
+		ofstream outputFile(arguments["output"].as<string>());
+		outputFile << jsonPrettyPrint(output) << endl;
+	}
+	else
+		cout << jsonPrettyPrint(output) << endl;
+
+	return 0;
+}
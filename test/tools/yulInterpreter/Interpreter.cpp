@@ -29,6 +29,7 @@
 #include <libyul/Utilities.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/wasm/WasmDialect.h>
+#include <libyul/optimiser/ExecutionProfile.h>
 
 #include <liblangutil/Exceptions.h>
 
@@ -295,6 +296,8 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 	FunctionDefinition const* fun = scope->names.at(_funCall.functionName.name);
 	yulAssert(fun, "Function not found.");
 	yulAssert(m_values.size() == fun->parameters.size(), "");
+	if (m_state.profile)
+		m_state.profile->recordCalls(fun->location);
 	map<YulString, u256> variables;
 	for (size_t i = 0; i < fun->parameters.size(); ++i)
 		variables[fun->parameters.at(i).name] = m_values.at(i);
@@ -34,6 +34,7 @@
 namespace solidity::yul
 {
 struct Dialect;
+class ExecutionProfile;
 }
 
 namespace solidity::yul::test
@@ -98,6 +99,8 @@ struct InterpreterState
 	size_t numSteps = 0;
 	size_t maxExprNesting = 0;
 	ControlFlowState controlFlowState = ControlFlowState::Default;
+	/// If set, the calls of user-defined functions are recorded here.
+	ExecutionProfile* profile = nullptr;
 
 	void dumpTraceAndState(std::ostream& _out) const;
 };
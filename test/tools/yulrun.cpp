@@ -21,12 +21,15 @@
 
 #include <test/tools/yulInterpreter/Interpreter.h>
 
+#include <libyul/AST.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmParser.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/Dialect.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AssemblyStack.h>
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/ExecutionProfile.h>
 
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/ErrorReporter.h>
@@ -36,9 +39,11 @@
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
 
 #include <boost/program_options.hpp>
 
+#include <fstream>
 #include <string>
 #include <memory>
 #include <iostream>
@@ -80,7 +85,25 @@ pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source
 	}
 }
 
-void interpret(string const& _source)
+/// Records all function definitions with zero calls, so that functions that were never
+/// called are part of the profile.
+class FunctionDefinitionRecorder: public ASTWalker
+{
+public:
+	explicit FunctionDefinitionRecorder(ExecutionProfile& _profile): m_profile(_profile) {}
+
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		m_profile.recordCalls(_function.location, 0);
+		ASTWalker::operator()(_function);
+	}
+
+private:
+	ExecutionProfile& m_profile;
+};
+
+void interpret(string const& _source, optional<string> const& _profileOutput)
 {
 	shared_ptr<Block> ast;
 	shared_ptr<AsmAnalysisInfo> analysisInfo;
@@ -88,8 +111,14 @@ void interpret(string const& _source)
 	if (!ast || !analysisInfo)
 		return;
 
+	ExecutionProfile profile;
 	InterpreterState state;
 	state.maxTraceSize = 10000;
+	if (_profileOutput)
+	{
+		FunctionDefinitionRecorder{profile}(*ast);
+		state.profile = &profile;
+	}
 	try
 	{
 		Dialect const& dialect(EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}));
@@ -100,6 +129,12 @@ void interpret(string const& _source)
 	}
 
 	state.dumpTraceAndState(cout);
+
+	if (_profileOutput)
+	{
+		ofstream profileFile(*_profileOutput);
+		profileFile << jsonPrettyPrint(profile.toJson()) << endl;
+	}
 }
 
 }
@@ -116,7 +151,13 @@ Allowed options)",
 		po::options_description::m_default_line_length - 23);
 	options.add_options()
 		("help", "Show this help screen.")
-		("input-file", po::value<vector<string>>(), "input file");
+		("input-file", po::value<vector<string>>(), "input file")
+		(
+			"profile-output",
+			po::value<string>()->value_name("file"),
+			"Write the number of calls of each function to the given file. "
+			"The file can be passed to the optimizer via solc --yul-execution-profile."
+		);
 	po::positional_options_description filesPositions;
 	filesPositions.add("input-file", -1);
 
@@ -154,7 +195,10 @@ Allowed options)",
 		else
 			input = readStandardInput();
 
-		interpret(input);
+		optional<string> profileOutput;
+		if (arguments.count("profile-output"))
+			profileOutput = arguments["profile-output"].as<string>();
+		interpret(input, profileOutput);
 	}
 
 	return 0;
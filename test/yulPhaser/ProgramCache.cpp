@@ -60,8 +60,8 @@ protected:
 	static set<string> cachedKeys(ProgramCache const& _programCache)
 	{
 		 set<string> keys;
-		for (auto pair = _programCache.entries().begin(); pair != _programCache.entries().end(); ++pair)
-			keys.insert(pair->first);
+		for (auto const& [key, entry]: _programCache.entries())
+			keys.insert(key);
 
 		return keys;
 	}
@@ -149,18 +149,18 @@ BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_reuse_the_longest_prefix_and_move
 
 	BOOST_TEST(m_programCache.currentRound() == 1);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu", "Ia"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Ia")->second.roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Ia")->second->roundNumber == 0);
 
 	m_programCache.optimiseProgram("IuOI");
 
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu", "Ia", "IuO", "IuOI"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 1);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 1);
-	BOOST_TEST(m_programCache.entries().find("Ia")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("IuO")->second.roundNumber == 1);
-	BOOST_TEST(m_programCache.entries().find("IuOI")->second.roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("Ia")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("IuO")->second->roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("IuOI")->second->roundNumber == 1);
 }
 
 BOOST_FIXTURE_TEST_CASE(startRound_should_remove_entries_older_than_two_rounds, ProgramCacheFixture)
@@ -172,40 +172,40 @@ BOOST_FIXTURE_TEST_CASE(startRound_should_remove_entries_older_than_two_rounds,
 
 	BOOST_TEST(m_programCache.currentRound() == 0);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 0);
 
 	m_programCache.optimiseProgram("a");
 
 	BOOST_TEST(m_programCache.currentRound() == 0);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu", "a"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("a")->second.roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("a")->second->roundNumber == 0);
 
 	m_programCache.startRound(1);
 
 	BOOST_TEST(m_programCache.currentRound() == 1);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu", "a"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("a")->second.roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("a")->second->roundNumber == 0);
 
 	m_programCache.optimiseProgram("af");
 
 	BOOST_TEST(m_programCache.currentRound() == 1);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"I", "Iu", "a", "af"}));
-	BOOST_TEST(m_programCache.entries().find("I")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("Iu")->second.roundNumber == 0);
-	BOOST_TEST(m_programCache.entries().find("a")->second.roundNumber == 1);
-	BOOST_TEST(m_programCache.entries().find("af")->second.roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("I")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("Iu")->second->roundNumber == 0);
+	BOOST_TEST(m_programCache.entries().find("a")->second->roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("af")->second->roundNumber == 1);
 
 	m_programCache.startRound(2);
 
 	BOOST_TEST(m_programCache.currentRound() == 2);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == set<string>{"a", "af"}));
-	BOOST_TEST(m_programCache.entries().find("a")->second.roundNumber == 1);
-	BOOST_TEST(m_programCache.entries().find("af")->second.roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("a")->second->roundNumber == 1);
+	BOOST_TEST(m_programCache.entries().find("af")->second->roundNumber == 1);
 
 	m_programCache.startRound(3);
 
@@ -59,32 +59,31 @@ Program ProgramCache::optimiseProgram(
 	for (size_t i = 1; i < _repetitionCount; ++i)
 		targetOptimisations += _abbreviatedOptimisationSteps;
 
+	TrieNode* node = &m_root;
 	size_t prefixSize = 0;
-	for (size_t i = 1; i <= targetOptimisations.size(); ++i)
+	for (; prefixSize < targetOptimisations.size(); ++prefixSize)
 	{
-		auto const& pair = m_entries.find(targetOptimisations.substr(0, i));
-		if (pair != m_entries.end())
-		{
-			pair->second.roundNumber = m_currentRound;
-			++prefixSize;
-			++m_hits;
-		}
-		else
+		auto child = node->children.find(targetOptimisations[prefixSize]);
+		if (child == node->children.end())
 			break;
+
+		node = child->second.get();
+		assert(node->entry.has_value());
+		node->entry->roundNumber = m_currentRound;
+		++m_hits;
 	}
 
-	Program intermediateProgram = (
-		prefixSize == 0 ?
-		m_program :
-		m_entries.at(targetOptimisations.substr(0, prefixSize)).program
-	);
+	Program intermediateProgram = (node->entry.has_value() ? node->entry->program : m_program);
 
-	for (size_t i = prefixSize + 1; i <= targetOptimisations.size(); ++i)
+	for (size_t i = prefixSize; i < targetOptimisations.size(); ++i)
 	{
-		string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i - 1]);
+		string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i]);
 		intermediateProgram.optimise({stepName});
 
-		m_entries.insert({targetOptimisations.substr(0, i), {intermediateProgram, m_currentRound}});
+		auto& child = node->children[targetOptimisations[i]];
+		child = make_unique<TrieNode>(TrieNode{CacheEntry{intermediateProgram, m_currentRound}, {}});
+		node = child.get();
+		++m_size;
 		++m_misses;
 	}
 
@@ -96,30 +95,33 @@ void ProgramCache::startRound(size_t _roundNumber)
 	assert(_roundNumber > m_currentRound);
 	m_currentRound = _roundNumber;
 
-	for (auto pair = m_entries.begin(); pair != m_entries.end();)
-	{
-		assert(pair->second.roundNumber < m_currentRound);
-
-		if (pair->second.roundNumber < m_currentRound - 1)
-			m_entries.erase(pair++);
-		else
-			++pair;
-	}
+	purgeEntries(m_root, m_currentRound - 1);
 }
 
 void ProgramCache::clear()
 {
-	m_entries.clear();
+	m_root.children.clear();
+	m_size = 0;
 	m_currentRound = 0;
 }
 
 Program const* ProgramCache::find(string const& _abbreviatedOptimisationSteps) const
 {
-	auto const& pair = m_entries.find(_abbreviatedOptimisationSteps);
-	if (pair == m_entries.end())
+	TrieNode const* node = findNode(_abbreviatedOptimisationSteps);
+	if (node == nullptr || !node->entry.has_value())
 		return nullptr;
 
-	return &(pair->second.program);
+	return &(node->entry->program);
+}
+
+map<string, CacheEntry const*> ProgramCache::entries() const
+{
+	map<string, CacheEntry const*> result;
+	forEachEntry([&](string const& _abbreviatedOptimisationSteps, CacheEntry const& _entry) {
+		result.insert({_abbreviatedOptimisationSteps, &_entry});
+	});
+
+	return result;
 }
 
 CacheStats ProgramCache::gatherStats() const
@@ -132,11 +134,75 @@ CacheStats ProgramCache::gatherStats() const
 	};
 }
 
+ProgramCache::TrieNode const* ProgramCache::findNode(string const& _abbreviatedOptimisationSteps) const
+{
+	TrieNode const* node = &m_root;
+	for (char abbreviation: _abbreviatedOptimisationSteps)
+	{
+		auto child = node->children.find(abbreviation);
+		if (child == node->children.end())
+			return nullptr;
+
+		node = child->second.get();
+	}
+
+	return node;
+}
+
+void ProgramCache::purgeEntries(TrieNode& _node, size_t _minRoundNumber)
+{
+	for (auto child = _node.children.begin(); child != _node.children.end();)
+	{
+		assert(child->second->entry->roundNumber < m_currentRound);
+
+		if (child->second->entry->roundNumber < _minRoundNumber)
+		{
+			// Entries are never older than their prefixes so the whole subtree is expired.
+			size_t subtreeSize = 0;
+			vector<TrieNode const*> nodes{child->second.get()};
+			while (!nodes.empty())
+			{
+				TrieNode const* node = nodes.back();
+				nodes.pop_back();
+				++subtreeSize;
+				for (auto const& grandchild: node->children)
+					nodes.push_back(grandchild.second.get());
+			}
+
+			assert(subtreeSize <= m_size);
+			m_size -= subtreeSize;
+			child = _node.children.erase(child);
+		}
+		else
+		{
+			purgeEntries(*child->second, _minRoundNumber);
+			++child;
+		}
+	}
+}
+
+void ProgramCache::forEachEntry(function<void(string const&, CacheEntry const&)> const& _callback) const
+{
+	vector<pair<string, TrieNode const*>> nodes{{"", &m_root}};
+	while (!nodes.empty())
+	{
+		auto [abbreviatedOptimisationSteps, node] = move(nodes.back());
+		nodes.pop_back();
+
+		if (node->entry.has_value())
+			_callback(abbreviatedOptimisationSteps, *node->entry);
+
+		for (auto const& [abbreviation, child]: node->children)
+			nodes.emplace_back(abbreviatedOptimisationSteps + abbreviation, child.get());
+	}
+}
+
 size_t ProgramCache::calculateTotalCachedCodeSize() const
 {
 	size_t size = 0;
-	for (auto const& pair: m_entries)
-		size += pair.second.program.codeSize(CacheStats::StorageWeights);
+	forEachEntry([&](string const&, CacheEntry const& _entry) {
+		size += _entry.program.codeSize(CacheStats::StorageWeights);
+	});
 
 	return size;
 }
@@ -144,11 +210,9 @@ size_t ProgramCache::calculateTotalCachedCodeSize() const
 map<size_t, size_t> ProgramCache::countRoundEntries() const
 {
 	map<size_t, size_t> counts;
-	for (auto& pair: m_entries)
-		if (counts.find(pair.second.roundNumber) != counts.end())
-			++counts.at(pair.second.roundNumber);
-		else
-			counts.insert({pair.second.roundNumber, 1});
+	forEachEntry([&](string const&, CacheEntry const& _entry) {
+		++counts[_entry.roundNumber];
+	});
 
 	return counts;
 }
@@ -22,7 +22,10 @@
 
 #include <libyul/optimiser/Metrics.h>
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace solidity::phaser
@@ -101,6 +104,11 @@ struct CacheStats
  * There is currently no way to purge entries without starting a new round. Since the programs
  * take a lot of memory, this may lead to the cache eating up all the available RAM if sequences are
  * long and programs large. A limiter based on entry count or total program size would be useful.
+ *
+ * Entries are stored in a trie of step abbreviations, so looking up the longest cached prefix
+ * of a sequence takes time proportional to its length. Since an entry is only ever used or
+ * created together with all its prefixes, an entry is never older than its prefixes and expired
+ * entries can be removed together with the whole subtree below them.
  */
 class ProgramCache
 {
@@ -115,24 +123,37 @@ public:
 	void startRound(size_t _nextRoundNumber);
 	void clear();
 
-	size_t size() const { return m_entries.size(); }
+	size_t size() const { return m_size; }
 	Program const* find(std::string const& _abbreviatedOptimisationSteps) const;
 	bool contains(std::string const& _abbreviatedOptimisationSteps) const { return find(_abbreviatedOptimisationSteps) != nullptr; }
 
 	CacheStats gatherStats() const;
 
-	std::map<std::string, CacheEntry> const& entries() const { return m_entries; }
+	/// Collects all entries of the cache, indexed by their abbreviated optimisation steps.
+	std::map<std::string, CacheEntry const*> entries() const;
 	Program const& program() const { return m_program; }
 	size_t currentRound() const { return m_currentRound; }
 
 private:
+	/// Node of the trie of step abbreviations. The node reached from the root by following
+	/// a sequence of abbreviations stores the program optimised with that sequence.
+	/// Only the root has no entry.
+	struct TrieNode
+	{
+		std::optional<CacheEntry> entry;
+		std::map<char, std::unique_ptr<TrieNode>> children;
+	};
+
+	TrieNode const* findNode(std::string const& _abbreviatedOptimisationSteps) const;
+	/// Removes all descendants of @a _node whose entries are older than @a _minRoundNumber.
+	void purgeEntries(TrieNode& _node, size_t _minRoundNumber);
+	/// Calls @a _callback for every entry in the cache, along with its abbreviated optimisation steps.
+	void forEachEntry(std::function<void(std::string const&, CacheEntry const&)> const& _callback) const;
 	size_t calculateTotalCachedCodeSize() const;
 	std::map<size_t, size_t> countRoundEntries() const;
 
-	// The best matching data structure here would be a trie of chromosome prefixes but since
-	// the programs are orders of magnitude larger than the prefixes, it does not really matter.
-	// A map should be good enough.
-	std::map<std::string, CacheEntry> m_entries;
+	TrieNode m_root;
+	size_t m_size = 0;
 
 	Program m_program;
 	size_t m_currentRound = 0;